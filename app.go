@@ -56,7 +56,6 @@ func CreateApp(optionalConfig ...*AppConfig) *App {
 	result := &App{
 		logLevel:       "debug",
 		renderer:       renderer.NewWebView(),
-		ipc:            ipc.NewManager(),
 		bindingManager: binding.NewManager(),
 		eventManager:   event.NewManager(),
 		log:            logger.NewCustomLogger("App"),
@@ -67,6 +66,7 @@ func CreateApp(optionalConfig ...*AppConfig) *App {
 		result.log.Fatalf("Cannot use custom HTML: %s", err.Error())
 	}
 	result.config = appconfig
+	result.ipc = ipc.NewManager(appconfig.IPC)
 
 	// Set up the CLI if not in release mode
 	if BuildMode != cmd.BuildModeProd {
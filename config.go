@@ -4,6 +4,7 @@ import (
 	"net/url"
 	"strings"
 
+	"github.com/wailsapp/wails/lib/ipc"
 	"github.com/wailsapp/wails/runtime"
 )
 
@@ -45,6 +46,11 @@ type AppConfig struct {
 
 	// Indicated if the devtools should be disabled
 	DisableInspector bool
+
+	// Controls how calls to bound Go methods are executed: the number of
+	// workers, how many calls may queue and per method concurrency limits.
+	// If nil, the defaults are used.
+	IPC *ipc.CallOptions
 }
 
 // GetWidth returns the desired width
@@ -164,6 +170,10 @@ func (a *AppConfig) merge(in *AppConfig) error {
 		a.MaxHeight = in.MaxHeight
 	}
 
+	if in.IPC != nil {
+		a.IPC = in.IPC
+	}
+
 	a.Resizable = in.Resizable
 	a.DisableInspector = in.DisableInspector
 
@@ -15,6 +15,7 @@ type boundFunction struct {
 	fullName           string
 	function           reflect.Value
 	functionType       reflect.Type
+	invoke             invoker // nil unless the signature has a fast path
 	inputs             []reflect.Type
 	returnTypes        []reflect.Type
 	log                *logger.CustomLogger
@@ -41,6 +42,9 @@ func newBoundFunction(object interface{}) (*boundFunction, error) {
 	}
 
 	err := result.processParameters()
+	if err == nil {
+		result.invoke = newInvoker(objectValue)
+	}
 
 	return result, err
 }
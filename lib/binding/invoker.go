@@ -0,0 +1,139 @@
+package binding
+
+import (
+	"encoding/json"
+	"reflect"
+	"strings"
+)
+
+// invoker calls a bound function or method with the JSON encoded arguments
+// given by the frontend, without going through reflect.Value.Call.
+// handled is false when the arguments could not be decoded directly into
+// the parameters, eg: a null value or a string passed to an int. The caller
+// then falls back to the reflection based call so that conversions and error
+// messages are the same as before.
+type invoker func(data string) (handled bool, result interface{}, err error)
+
+// newInvoker returns an invoker for fn if its signature is one of the
+// common shapes below, or nil if it needs the reflection based call.
+// fn.Interface() is only type asserted here, once, at registration.
+func newInvoker(fn reflect.Value) invoker {
+	switch f := fn.Interface().(type) {
+
+	// No parameters
+	case func():
+		return noArgs(func() (interface{}, error) { f(); return nil, nil })
+	case func() error:
+		return noArgs(func() (interface{}, error) { return nil, f() })
+	case func() string:
+		return noArgs(func() (interface{}, error) { return f(), nil })
+	case func() (string, error):
+		return noArgs(func() (interface{}, error) { return withError(f()) })
+	case func() interface{}:
+		return noArgs(func() (interface{}, error) { return f(), nil })
+	case func() (interface{}, error):
+		return noArgs(func() (interface{}, error) { return withError(f()) })
+
+	// A single string
+	case func(string):
+		return stringArg(func(a string) (interface{}, error) { f(a); return nil, nil })
+	case func(string) error:
+		return stringArg(func(a string) (interface{}, error) { return nil, f(a) })
+	case func(string) string:
+		return stringArg(func(a string) (interface{}, error) { return f(a), nil })
+	case func(string) (string, error):
+		return stringArg(func(a string) (interface{}, error) { return withError(f(a)) })
+	case func(string) interface{}:
+		return stringArg(func(a string) (interface{}, error) { return f(a), nil })
+	case func(string) (interface{}, error):
+		return stringArg(func(a string) (interface{}, error) { return withError(f(a)) })
+
+	// A single int
+	case func(int):
+		return intArg(func(a int) (interface{}, error) { f(a); return nil, nil })
+	case func(int) error:
+		return intArg(func(a int) (interface{}, error) { return nil, f(a) })
+	case func(int) int:
+		return intArg(func(a int) (interface{}, error) { return f(a), nil })
+	case func(int) (int, error):
+		return intArg(func(a int) (interface{}, error) { return withError(f(a)) })
+	case func(int) interface{}:
+		return intArg(func(a int) (interface{}, error) { return f(a), nil })
+	case func(int) (interface{}, error):
+		return intArg(func(a int) (interface{}, error) { return withError(f(a)) })
+
+	// A single float64
+	case func(float64):
+		return floatArg(func(a float64) (interface{}, error) { f(a); return nil, nil })
+	case func(float64) error:
+		return floatArg(func(a float64) (interface{}, error) { return nil, f(a) })
+	case func(float64) float64:
+		return floatArg(func(a float64) (interface{}, error) { return f(a), nil })
+	case func(float64) (float64, error):
+		return floatArg(func(a float64) (interface{}, error) { return withError(f(a)) })
+	case func(float64) interface{}:
+		return floatArg(func(a float64) (interface{}, error) { return f(a), nil })
+	case func(float64) (interface{}, error):
+		return floatArg(func(a float64) (interface{}, error) { return withError(f(a)) })
+	}
+	return nil
+}
+
+// withError returns the result of a (value, error) call the same way the
+// reflection based call does: the value is dropped if there is an error
+func withError(result interface{}, err error) (interface{}, error) {
+	if err != nil {
+		return nil, err
+	}
+	return result, nil
+}
+
+func noArgs(call func() (interface{}, error)) invoker {
+	return func(data string) (bool, interface{}, error) {
+		if strings.TrimSpace(data) != "[]" {
+			return false, nil, nil
+		}
+		result, err := call()
+		return true, result, err
+	}
+}
+
+// The arguments are decoded into pointers so that null, which the reflection
+// based call treats differently for functions and methods, can be detected
+
+func stringArg(call func(string) (interface{}, error)) invoker {
+	return func(data string) (bool, interface{}, error) {
+		var args []*string
+		if json.Unmarshal([]byte(data), &args) != nil || len(args) != 1 || args[0] == nil {
+			return false, nil, nil
+		}
+		result, err := call(*args[0])
+		return true, result, err
+	}
+}
+
+// Ints are decoded as float64 and converted the way reflect.Value.Convert
+// does, so fractions are truncated and integers beyond 2^53 are rounded,
+// just as they are by the reflection based call
+
+func intArg(call func(int) (interface{}, error)) invoker {
+	return func(data string) (bool, interface{}, error) {
+		var args []*float64
+		if json.Unmarshal([]byte(data), &args) != nil || len(args) != 1 || args[0] == nil {
+			return false, nil, nil
+		}
+		result, err := call(int(int64(*args[0])))
+		return true, result, err
+	}
+}
+
+func floatArg(call func(float64) (interface{}, error)) invoker {
+	return func(data string) (bool, interface{}, error) {
+		var args []*float64
+		if json.Unmarshal([]byte(data), &args) != nil || len(args) != 1 || args[0] == nil {
+			return false, nil, nil
+		}
+		result, err := call(*args[0])
+		return true, result, err
+	}
+}
@@ -0,0 +1,161 @@
+package binding
+
+import (
+	"errors"
+	"reflect"
+	"testing"
+
+	"github.com/wailsapp/wails/lib/logger"
+	"github.com/wailsapp/wails/lib/messages"
+)
+
+type testService struct{}
+
+func (testService) Ping()                      {}
+func (testService) Greet(name string) string   { return "Hello " + name }
+func (testService) Double(value int) int       { return value * 2 }
+func (testService) Sum(a int, b int) int       { return a + b }
+func (testService) Echo(value interface{}) int { return 1 }
+func (testService) Half(value float64) (float64, error) {
+	if value < 0 {
+		return 0, errors.New("negative")
+	}
+	return value / 2, nil
+}
+func (testService) Lookup(key string) (interface{}, error) {
+	if key == "" {
+		return nil, errors.New("empty key")
+	}
+	return map[string]interface{}{"key": key}, nil
+}
+func (testService) Store(values map[string]interface{}) error { return nil }
+
+func testFunction(name string) (string, error) { return "Hello " + name, nil }
+
+// newTestManager binds the methods of object and the given functions. If
+// reflectOnly is set, every call goes through the reflection based path.
+func newTestManager(tb testing.TB, object interface{}, functions []interface{}, reflectOnly bool) *Manager {
+	manager := &Manager{
+		methods:   make(map[string]*boundMethod),
+		functions: make(map[string]*boundFunction),
+		log:       logger.NewCustomLogger("Bind"),
+	}
+	objectType := reflect.TypeOf(object)
+	for i := 0; i < objectType.NumMethod(); i++ {
+		name := objectType.Method(i).Name
+		method, err := newBoundMethod(name, "main.testService."+name, reflect.ValueOf(object).MethodByName(name), objectType)
+		if err != nil {
+			tb.Fatal(err)
+		}
+		if reflectOnly {
+			method.invoke = nil
+		}
+		manager.methods[method.fullName] = method
+	}
+	for _, object := range functions {
+		function, err := newBoundFunction(object)
+		if err != nil {
+			tb.Fatal(err)
+		}
+		if reflectOnly {
+			function.invoke = nil
+		}
+		manager.functions[function.fullName] = function
+	}
+	return manager
+}
+
+func TestInvokerSelection(t *testing.T) {
+	manager := newTestManager(t, testService{}, []interface{}{testFunction}, false)
+	fast := map[string]bool{
+		"main.testService.Ping":   true,
+		"main.testService.Greet":  true,
+		"main.testService.Double": true,
+		"main.testService.Half":   true,
+		"main.testService.Lookup": true,
+		"main.testService.Sum":    false,
+		"main.testService.Echo":   false,
+		"main.testService.Store":  false,
+	}
+	for name, expected := range fast {
+		if got := manager.methods[name].invoke != nil; got != expected {
+			t.Errorf("%s: expected fast path %t, got %t", name, expected, got)
+		}
+	}
+	if manager.functions["binding.testFunction"].invoke == nil {
+		t.Errorf("expected fast path for testFunction")
+	}
+}
+
+// TestInvokerMatchesReflection checks that every call returns exactly what the
+// reflection based call returns, including for arguments that need converting
+// or that are rejected
+func TestInvokerMatchesReflection(t *testing.T) {
+	functions := []interface{}{testFunction}
+	fast := newTestManager(t, testService{}, functions, false)
+	slow := newTestManager(t, testService{}, functions, true)
+
+	bindings := []string{"binding.testFunction"}
+	for name := range fast.methods {
+		bindings = append(bindings, name)
+	}
+	inputs := []string{
+		`[]`, ` [ ] `, `["bob"]`, `[""]`, `[null]`, `[3]`, `[-3]`, `[1.7]`, `[1e2]`, `[300]`,
+		`[9007199254740993]`, `[-9007199254740993]`, `[1e20]`,
+		`[true]`, `["a","b"]`, `[1,2]`, `[{"a":1}]`, `{}`, `null`, `not json`, `["bob"] trailing`,
+	}
+	for _, binding := range bindings {
+		for _, input := range inputs {
+			if input == `[null]` && (binding == "main.testService.Echo" || binding == "main.testService.Store") {
+				// The reflection based call can't convert null to these
+				// parameter types and panics
+				continue
+			}
+			callData := &messages.CallData{BindingName: binding, Data: input}
+			fastResult, fastErr := fast.ProcessCall(callData)
+			slowResult, slowErr := slow.ProcessCall(callData)
+			if !reflect.DeepEqual(fastResult, slowResult) {
+				t.Errorf("%s(%s): result %#v, reflection returned %#v", binding, input, fastResult, slowResult)
+			}
+			if (fastErr == nil) != (slowErr == nil) || fastErr != nil && fastErr.Error() != slowErr.Error() {
+				t.Errorf("%s(%s): error %v, reflection returned %v", binding, input, fastErr, slowErr)
+			}
+		}
+	}
+}
+
+func BenchmarkCall(b *testing.B) {
+	calls := []struct {
+		name string
+		data string
+	}{
+		{"main.testService.Ping", `[]`},
+		{"main.testService.Greet", `["world"]`},
+		{"main.testService.Double", `[21]`},
+		{"main.testService.Half", `[21.5]`},
+		{"main.testService.Lookup", `["key"]`},
+		{"binding.testFunction", `["world"]`},
+	}
+	functions := []interface{}{testFunction}
+	managers := []struct {
+		name    string
+		manager *Manager
+	}{
+		{"invoker", newTestManager(b, testService{}, functions, false)},
+		{"reflect", newTestManager(b, testService{}, functions, true)},
+	}
+	for _, call := range calls {
+		callData := &messages.CallData{BindingName: call.name, Data: call.data}
+		for _, m := range managers {
+			manager := m.manager
+			b.Run(call.name+"/"+m.name, func(b *testing.B) {
+				b.ReportAllocs()
+				for i := 0; i < b.N; i++ {
+					if _, err := manager.ProcessCall(callData); err != nil {
+						b.Fatal(err)
+					}
+				}
+			})
+		}
+	}
+}
@@ -245,6 +245,14 @@ func (b *Manager) processFunctionCall(callData *messages.CallData) (interface{},
 	if function == nil {
 		return nil, fmt.Errorf("Invalid function name '%s'", callData.BindingName)
 	}
+
+	// Common signatures are called directly
+	if function.invoke != nil {
+		if handled, result, err := function.invoke(callData.Data); handled {
+			return result, err
+		}
+	}
+
 	result, err = function.call(callData.Data)
 	if err != nil {
 		return nil, err
@@ -280,6 +288,13 @@ func (b *Manager) processMethodCall(callData *messages.CallData) (interface{}, e
 		return nil, fmt.Errorf("Invalid method name '%s'", callData.BindingName)
 	}
 
+	// Common signatures are called directly
+	if method.invoke != nil {
+		if handled, result, err := method.invoke(callData.Data); handled {
+			return result, err
+		}
+	}
+
 	result, err = method.call(callData.Data)
 	if err != nil {
 		return nil, err
@@ -13,6 +13,7 @@ type boundMethod struct {
 	Name               string
 	fullName           string
 	method             reflect.Value
+	invoke             invoker // nil unless the signature has a fast path
 	inputs             []reflect.Type
 	returnTypes        []reflect.Type
 	log                *logger.CustomLogger
@@ -34,6 +35,9 @@ func newBoundMethod(name string, fullName string, method reflect.Value, objectTy
 
 	// Check if Parameters are valid
 	err := result.processParameters()
+	if err == nil {
+		result.invoke = newInvoker(method)
+	}
 
 	// Are we a WailsInit method?
 	if result.Name == "WailsInit" {
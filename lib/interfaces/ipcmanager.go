@@ -10,4 +10,34 @@ type IPCManager interface {
 	Dispatch(message string, f CallbackFunc)
 	Start(eventManager EventManager, bindingManager BindingManager)
 	Shutdown()
+
+	// CallStats returns a snapshot of the binding call queue. It is empty
+	// until the manager has been started.
+	CallStats() CallStats
+}
+
+// CallStats is a snapshot of the call queue
+type CallStats struct {
+	// Queued is the number of calls waiting for a worker. Calls held back
+	// by a binding's concurrency limit are counted in its Waiting.
+	Queued int
+	// MaxQueued is the highest Queued has been
+	MaxQueued int
+	// Running is the number of calls currently executing
+	Running int
+	// Completed is the number of calls that have finished
+	Completed uint64
+	// Bindings holds the stats for each binding that has been called
+	Bindings map[string]BindingStats
+}
+
+// BindingStats is a snapshot of the calls to a single binding
+type BindingStats struct {
+	// Waiting is the number of calls held back by the binding's
+	// concurrency limit
+	Waiting int
+	// Active is the number of calls queued for or running on a worker
+	Active int
+	// Completed is the number of calls that have finished
+	Completed uint64
 }
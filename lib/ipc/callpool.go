@@ -0,0 +1,252 @@
+package ipc
+
+import (
+	"sync"
+
+	"github.com/wailsapp/wails/lib/interfaces"
+	"github.com/wailsapp/wails/lib/logger"
+	"github.com/wailsapp/wails/lib/messages"
+)
+
+// Defaults used for any CallOptions fields left at zero
+const (
+	defaultCallWorkers   = 64
+	defaultCallQueueSize = 1000
+)
+
+// CallOptions configures how calls to bound Go methods are executed
+type CallOptions struct {
+	// Workers is the number of goroutines executing calls. Defaults to 64.
+	// Calls that block, such as opening a dialog, hold a worker until they
+	// return.
+	Workers int
+
+	// QueueSize is the number of calls that may wait for a worker. Once
+	// it is reached, the IPC Manager stops reading messages from the
+	// frontend until a call starts. Calls held back by a binding's
+	// concurrency limit don't count towards it, so a slow binding can't
+	// stop events and logs being read. Defaults to 1000.
+	QueueSize int
+
+	// MaxConcurrentPerBinding caps how many calls to a single binding run
+	// at once. 0 means calls are only limited by the number of workers.
+	MaxConcurrentPerBinding int
+
+	// Bindings overrides the defaults for individual bindings, keyed by
+	// binding name, eg: "main.MyStruct.MyMethod"
+	Bindings map[string]BindingOptions
+}
+
+// BindingOptions configures how calls to a single binding are executed
+type BindingOptions struct {
+	// MaxConcurrent caps how many calls to this binding run at once.
+	// 0 means the CallOptions default applies.
+	MaxConcurrent int
+
+	// Ordered runs calls to this binding one at a time, in the order
+	// they were received from the frontend
+	Ordered bool
+}
+
+// pendingCall is a call that has been accepted but not yet run
+type pendingCall struct {
+	message  *ipcMessage
+	callData *messages.CallData
+	binding  *bindingState
+}
+
+// bindingState tracks the calls to a single binding
+type bindingState struct {
+	limit     int
+	active    int
+	waiting   []*pendingCall
+	completed uint64
+}
+
+// callPool runs binding calls on a fixed set of workers
+type callPool struct {
+	options        CallOptions
+	bindingManager interfaces.BindingManager
+	log            *logger.CustomLogger
+
+	// Calls that may start as soon as a worker is free
+	ready chan *pendingCall
+
+	// Holds a token for every call in ready, so submit blocks once
+	// QueueSize calls are waiting for a worker
+	slots chan struct{}
+
+	quit chan struct{}
+
+	lock      sync.Mutex
+	bindings  map[string]*bindingState
+	queued    int
+	maxQueued int
+	running   int
+	completed uint64
+}
+
+func newCallPool(options CallOptions, bindingManager interfaces.BindingManager, log *logger.CustomLogger) *callPool {
+	if options.Workers <= 0 {
+		options.Workers = defaultCallWorkers
+	}
+	if options.QueueSize <= 0 {
+		options.QueueSize = defaultCallQueueSize
+	}
+	result := &callPool{
+		options:        options,
+		bindingManager: bindingManager,
+		log:            log,
+		ready:          make(chan *pendingCall, options.QueueSize),
+		slots:          make(chan struct{}, options.QueueSize),
+		quit:           make(chan struct{}),
+		bindings:       make(map[string]*bindingState),
+	}
+	for worker := 0; worker < options.Workers; worker++ {
+		go result.worker()
+	}
+	return result
+}
+
+// bindingState returns the state for the given binding, creating it if
+// needed. Must be called with the lock held.
+func (p *callPool) bindingState(name string) *bindingState {
+	state := p.bindings[name]
+	if state == nil {
+		state = &bindingState{limit: p.options.MaxConcurrentPerBinding}
+		if bindingOptions, ok := p.options.Bindings[name]; ok {
+			if bindingOptions.MaxConcurrent > 0 {
+				state.limit = bindingOptions.MaxConcurrent
+			}
+			if bindingOptions.Ordered {
+				state.limit = 1
+			}
+		}
+		p.bindings[name] = state
+	}
+	return state
+}
+
+// submit queues a call. It blocks while QueueSize calls are waiting for a
+// worker.
+func (p *callPool) submit(message *ipcMessage, callData *messages.CallData) {
+	p.lock.Lock()
+	state := p.bindingState(callData.BindingName)
+	call := &pendingCall{message: message, callData: callData, binding: state}
+	if state.limit > 0 && state.active >= state.limit {
+		// Started by the worker that finishes the binding's current call
+		state.waiting = append(state.waiting, call)
+		p.lock.Unlock()
+		return
+	}
+	state.active++
+	p.lock.Unlock()
+
+	select {
+	case p.slots <- struct{}{}:
+	case <-p.quit:
+		return
+	}
+
+	p.lock.Lock()
+	p.queued++
+	if p.queued > p.maxQueued {
+		p.maxQueued = p.queued
+	}
+	p.lock.Unlock()
+
+	// Never blocks: every call in ready holds a slot
+	p.ready <- call
+}
+
+func (p *callPool) worker() {
+	for {
+		select {
+		case call := <-p.ready:
+			p.run(call)
+		case <-p.quit:
+			return
+		}
+	}
+}
+
+// run executes the call, then any calls to the same binding that were held
+// back by its concurrency limit. Running them here rather than requeueing
+// them keeps ordered bindings in order.
+func (p *callPool) run(call *pendingCall) {
+	// Only the call taken from ready holds a slot
+	<-p.slots
+	p.lock.Lock()
+	p.queued--
+	p.lock.Unlock()
+	for call != nil {
+		p.lock.Lock()
+		p.running++
+		p.lock.Unlock()
+
+		p.execute(call)
+
+		p.lock.Lock()
+		p.running--
+		p.completed++
+		state := call.binding
+		state.completed++
+		call = nil
+		if len(state.waiting) > 0 {
+			call = state.waiting[0]
+			state.waiting[0] = nil
+			state.waiting = state.waiting[1:]
+		} else {
+			state.active--
+		}
+		p.lock.Unlock()
+
+		if call != nil {
+			select {
+			case <-p.quit:
+				return
+			default:
+			}
+		}
+	}
+}
+
+func (p *callPool) execute(call *pendingCall) {
+	result, err := p.bindingManager.ProcessCall(call.callData)
+	p.log.DebugFields("processed call", logger.Fields{"result": result, "err": err})
+	if err != nil {
+		call.message.ReturnError(err.Error())
+	} else {
+		call.message.ReturnSuccess(result)
+	}
+	p.log.DebugFields("Finished processing call", logger.Fields{
+		"1D": &call.message,
+	})
+}
+
+func (p *callPool) stats() interfaces.CallStats {
+	p.lock.Lock()
+	defer p.lock.Unlock()
+	result := interfaces.CallStats{
+		Queued:    p.queued,
+		MaxQueued: p.maxQueued,
+		Running:   p.running,
+		Completed: p.completed,
+		Bindings:  make(map[string]interfaces.BindingStats, len(p.bindings)),
+	}
+	for name, state := range p.bindings {
+		result.Bindings[name] = interfaces.BindingStats{
+			Waiting:   len(state.waiting),
+			Active:    state.active,
+			Completed: state.completed,
+		}
+	}
+	return result
+}
+
+// shutdown stops the pool taking calls. Calls that have not started are
+// dropped. Running calls are not waited for, as a call blocked on IO would
+// hang the app's exit. Their workers stop once they return.
+func (p *callPool) shutdown() {
+	close(p.quit)
+}
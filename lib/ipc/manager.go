@@ -20,16 +20,22 @@ type Manager struct {
 	bindingManager interfaces.BindingManager
 	running        bool
 	wg             sync.WaitGroup
+	callOptions    CallOptions
+	calls          *callPool
 }
 
 // NewManager creates a new IPC Manager
-func NewManager() interfaces.IPCManager {
+// If no call options are given, the defaults are used
+func NewManager(optionalCallOptions ...*CallOptions) interfaces.IPCManager {
 	result := &Manager{
 		messageQueue: make(chan *ipcMessage, 100),
 		quitChannel:  make(chan struct{}),
 		// 		signals:      make(chan os.Signal, 1),
 		log: logger.NewCustomLogger("IPC"),
 	}
+	if len(optionalCallOptions) > 0 && optionalCallOptions[0] != nil {
+		result.callOptions = *optionalCallOptions[0]
+	}
 	return result
 }
 
@@ -49,6 +55,9 @@ func (i *Manager) Start(eventManager interfaces.EventManager, bindingManager int
 	// signal.Notify(manager.signals, os.Interrupt)
 	i.running = true
 
+	// Start the workers that execute binding calls
+	i.calls = newCallPool(i.callOptions, bindingManager, i.log)
+
 	// Keep track of this goroutine
 	i.wg.Add(1)
 	go func() {
@@ -66,18 +75,8 @@ func (i *Manager) Start(eventManager interfaces.EventManager, bindingManager int
 						"bindingName": callData.BindingName,
 						"data":        callData.Data,
 					})
-					go func() {
-						result, err := bindingManager.ProcessCall(callData)
-						i.log.DebugFields("processed call", logger.Fields{"result": result, "err": err})
-						if err != nil {
-							incomingMessage.ReturnError(err.Error())
-						} else {
-							incomingMessage.ReturnSuccess(result)
-						}
-						i.log.DebugFields("Finished processing call", logger.Fields{
-							"1D": &incomingMessage,
-						})
-					}()
+					// Blocks while the call queue is full
+					i.calls.submit(incomingMessage, callData)
 				case "event":
 
 					// Extract event data
@@ -176,7 +175,22 @@ func (i *Manager) SendResponse(cb interfaces.CallbackFunc) func(i *ipcResponse)
 // Shutdown is called when exiting the Application
 func (i *Manager) Shutdown() {
 	i.log.Debug("Shutdown called")
+	// The main loop and call workers only exist once started
+	if i.calls == nil {
+		return
+	}
+	// Stop the call workers first so the main loop can't be left
+	// blocked on a full call queue
+	i.calls.shutdown()
 	i.quitChannel <- struct{}{}
 	i.log.Debug("Waiting of main loop shutdown")
 	i.wg.Wait()
 }
+
+// CallStats returns a snapshot of the binding call queue
+func (i *Manager) CallStats() interfaces.CallStats {
+	if i.calls == nil {
+		return interfaces.CallStats{}
+	}
+	return i.calls.stats()
+}
@@ -0,0 +1,279 @@
+package ipc
+
+import (
+	"fmt"
+	"strconv"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/wailsapp/wails/lib/interfaces"
+	"github.com/wailsapp/wails/lib/messages"
+)
+
+// testBindings is a BindingManager with a fast binding, a slow binding and
+// an ordered binding that records the order calls ran in
+type testBindings struct {
+	slowRunning   int32
+	slowMaxSeen   int32
+	orderedLock   sync.Mutex
+	orderedCalls  []int
+	orderedActive int32
+	orderedErrors int32
+}
+
+func (t *testBindings) Bind(object interface{}) {}
+func (t *testBindings) Start(renderer interfaces.Renderer, runtime interfaces.Runtime) error {
+	return nil
+}
+func (t *testBindings) Shutdown() {}
+
+func (t *testBindings) ProcessCall(callData *messages.CallData) (interface{}, error) {
+	switch callData.BindingName {
+	case "main.fast":
+		return callData.Data, nil
+	case "main.slow":
+		running := atomic.AddInt32(&t.slowRunning, 1)
+		for {
+			seen := atomic.LoadInt32(&t.slowMaxSeen)
+			if running <= seen || atomic.CompareAndSwapInt32(&t.slowMaxSeen, seen, running) {
+				break
+			}
+		}
+		time.Sleep(time.Millisecond)
+		atomic.AddInt32(&t.slowRunning, -1)
+		return callData.Data, nil
+	case "main.ordered":
+		if atomic.AddInt32(&t.orderedActive, 1) != 1 {
+			atomic.AddInt32(&t.orderedErrors, 1)
+		}
+		sequence, _ := strconv.Atoi(callData.Data)
+		t.orderedLock.Lock()
+		t.orderedCalls = append(t.orderedCalls, sequence)
+		t.orderedLock.Unlock()
+		atomic.AddInt32(&t.orderedActive, -1)
+		return nil, nil
+	}
+	return nil, fmt.Errorf("unknown binding %s", callData.BindingName)
+}
+
+func callMessage(binding string, callbackID int, data string) string {
+	return fmt.Sprintf(`{"type":"call","callbackid":"%d","payload":{"bindingName":"%s","data":"%s"}}`, callbackID, binding, data)
+}
+
+func TestCallPoolLoad(t *testing.T) {
+	if testing.Short() {
+		t.Skip("skipping load test in short mode")
+	}
+
+	const calls = 100000
+	const slowLimit = 4
+	options := &CallOptions{
+		Workers:   16,
+		QueueSize: 256,
+		Bindings: map[string]BindingOptions{
+			"main.slow":    {MaxConcurrent: slowLimit},
+			"main.ordered": {Ordered: true},
+		},
+	}
+	bindings := &testBindings{}
+	manager := NewManager(options).(*Manager)
+	manager.Start(nil, bindings)
+
+	var responses sync.WaitGroup
+	responses.Add(calls)
+	var errors int32
+	callback := func(data string) error {
+		if data == "" {
+			atomic.AddInt32(&errors, 1)
+		}
+		responses.Done()
+		return nil
+	}
+
+	// Roughly 5% slow, 10% ordered and the rest fast
+	expectedOrdered := 0
+	start := time.Now()
+	for call := 0; call < calls; call++ {
+		switch {
+		case call%20 == 0:
+			manager.Dispatch(callMessage("main.slow", call, "slow"), callback)
+		case call%10 == 1:
+			manager.Dispatch(callMessage("main.ordered", call, strconv.Itoa(expectedOrdered)), callback)
+			expectedOrdered++
+		default:
+			manager.Dispatch(callMessage("main.fast", call, "fast"), callback)
+		}
+	}
+	responses.Wait()
+	elapsed := time.Since(start)
+
+	if errors != 0 {
+		t.Errorf("%d calls returned empty responses", errors)
+	}
+	if bindings.slowMaxSeen > slowLimit {
+		t.Errorf("slow binding ran %d calls at once, limit is %d", bindings.slowMaxSeen, slowLimit)
+	}
+	if bindings.orderedErrors != 0 {
+		t.Errorf("ordered binding ran concurrently %d times", bindings.orderedErrors)
+	}
+	if len(bindings.orderedCalls) != expectedOrdered {
+		t.Fatalf("expected %d ordered calls, got %d", expectedOrdered, len(bindings.orderedCalls))
+	}
+	for index, sequence := range bindings.orderedCalls {
+		if index != sequence {
+			t.Fatalf("ordered call %d ran at position %d", sequence, index)
+		}
+	}
+
+	stats := manager.CallStats()
+	if stats.Completed != calls || stats.Queued != 0 || stats.Running != 0 {
+		t.Errorf("unexpected stats after load: %+v", stats)
+	}
+	if stats.MaxQueued > options.QueueSize {
+		t.Errorf("queue grew to %d, limit is %d", stats.MaxQueued, options.QueueSize)
+	}
+	for name, binding := range stats.Bindings {
+		if binding.Waiting != 0 || binding.Active != 0 {
+			t.Errorf("binding %s still has calls outstanding: %+v", name, binding)
+		}
+	}
+	t.Logf("%d calls in %v (%.0f calls/sec), max queue depth %d", calls, elapsed, calls/elapsed.Seconds(), stats.MaxQueued)
+
+	manager.Shutdown()
+}
+
+func TestCallPoolShutdownWithFullQueue(t *testing.T) {
+	block := make(chan struct{})
+	bindings := &blockingBindings{block: block}
+	manager := NewManager(&CallOptions{Workers: 1, QueueSize: 1}).(*Manager)
+	manager.Start(nil, bindings)
+
+	callback := func(string) error { return nil }
+	go func() {
+		for call := 0; call < 10; call++ {
+			manager.Dispatch(callMessage("main.block", call, ""), callback)
+		}
+	}()
+	time.Sleep(10 * time.Millisecond)
+
+	done := make(chan struct{})
+	go func() {
+		manager.Shutdown()
+		close(done)
+	}()
+	close(block)
+	select {
+	case <-done:
+	case <-time.After(5 * time.Second):
+		t.Fatal("Shutdown blocked")
+	}
+}
+
+func TestShutdownDoesNotWaitForRunningCalls(t *testing.T) {
+	block := make(chan struct{})
+	defer close(block)
+	bindings := &blockingBindings{block: block}
+	manager := NewManager(&CallOptions{Workers: 1}).(*Manager)
+	manager.Start(nil, bindings)
+
+	manager.Dispatch(callMessage("main.block", 1, ""), func(string) error { return nil })
+	for manager.CallStats().Running == 0 {
+		time.Sleep(time.Millisecond)
+	}
+
+	done := make(chan struct{})
+	go func() {
+		manager.Shutdown()
+		close(done)
+	}()
+	select {
+	case <-done:
+	case <-time.After(5 * time.Second):
+		t.Fatal("Shutdown waited for a blocked call")
+	}
+}
+
+func TestShutdownWithoutStart(t *testing.T) {
+	manager := NewManager(&CallOptions{})
+	manager.Shutdown()
+	if stats := manager.CallStats(); stats.Completed != 0 || stats.Bindings != nil {
+		t.Errorf("expected empty stats, got %+v", stats)
+	}
+}
+
+// testEvents counts the events pushed to it
+type testEvents struct {
+	interfaces.EventManager
+	pushed int32
+}
+
+func (t *testEvents) PushEvent(*messages.EventData) {
+	atomic.AddInt32(&t.pushed, 1)
+}
+
+func TestSlowOrderedBindingDoesNotStallEvents(t *testing.T) {
+	if testing.Short() {
+		t.Skip("skipping load test in short mode")
+	}
+
+	const queueSize = 16
+	const calls = 10 * queueSize
+	block := make(chan struct{})
+	var unblock sync.Once
+	defer unblock.Do(func() { close(block) })
+	bindings := &blockingBindings{block: block}
+	events := &testEvents{}
+	manager := NewManager(&CallOptions{
+		Workers:   4,
+		QueueSize: queueSize,
+		Bindings:  map[string]BindingOptions{"main.block": {Ordered: true}},
+	}).(*Manager)
+	manager.Start(events, bindings)
+
+	var responses sync.WaitGroup
+	responses.Add(calls)
+	callback := func(string) error {
+		responses.Done()
+		return nil
+	}
+
+	// The first call blocks and the rest wait behind it, many more than
+	// fit in the queue
+	go func() {
+		for call := 0; call < calls; call++ {
+			manager.Dispatch(callMessage("main.block", call, ""), callback)
+		}
+		for event := 0; event < 10; event++ {
+			manager.Dispatch(`{"type":"event","payload":{"name":"progress","data":"[1]"}}`, nil)
+		}
+	}()
+	deadline := time.Now().Add(5 * time.Second)
+	for atomic.LoadInt32(&events.pushed) != 10 {
+		if time.Now().After(deadline) {
+			t.Fatalf("events stalled behind the ordered binding: %d of 10 pushed", atomic.LoadInt32(&events.pushed))
+		}
+		time.Sleep(time.Millisecond)
+	}
+	if waiting := manager.CallStats().Bindings["main.block"].Waiting; waiting != calls-1 {
+		t.Errorf("expected %d calls waiting, got %d", calls-1, waiting)
+	}
+
+	unblock.Do(func() { close(block) })
+	responses.Wait()
+	if stats := manager.CallStats(); stats.Completed != calls || stats.MaxQueued > queueSize {
+		t.Errorf("unexpected stats: %+v", stats)
+	}
+	manager.Shutdown()
+}
+
+type blockingBindings struct {
+	testBindings
+	block chan struct{}
+}
+
+func (b *blockingBindings) ProcessCall(callData *messages.CallData) (interface{}, error) {
+	<-b.block
+	return nil, nil
+}
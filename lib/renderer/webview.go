@@ -1,12 +1,10 @@
 package renderer
 
 import (
+	"bytes"
 	"encoding/json"
 	"fmt"
-	"math/rand"
-	"strings"
 	"sync"
-	"time"
 
 	"github.com/wailsapp/wails/runtime"
 
@@ -157,10 +155,7 @@ func (w *WebView) evalJS(js string) error {
 
 // Escape the Javascripts!
 func escapeJS(js string) (string, error) {
-	result := strings.Replace(js, "\\", "\\\\", -1)
-	result = strings.Replace(result, "'", "\\'", -1)
-	result = strings.Replace(result, "\n", "\\n", -1)
-	return result, nil
+	return wv.EscapeJS(js), nil
 }
 
 // evalJSSync evaluates the given js in the WebView synchronously
@@ -180,31 +175,32 @@ func (w *WebView) evalJSSync(js string) error {
 	}
 	w.log.DebugFields("EvalSync", logger.Fields{"js": outputJS})
 
-	ID := fmt.Sprintf("syncjs:%d:%d", time.Now().Unix(), rand.Intn(9999))
-	var wg sync.WaitGroup
-	wg.Add(1)
-
-	go func() {
-		exit := false
-		// We are done when we receive the Callback ID
-		w.log.Debug("SyncJS: sending with ID = " + ID)
-		w.eventManager.On(ID, func(...interface{}) {
-			w.log.Debug("SyncJS: Got callback ID = " + ID)
-			wg.Done()
-			exit = true
-		})
-		command := fmt.Sprintf("wails._.AddScript('%s', '%s')", minified, ID)
-		w.window.Dispatch(func() {
-			w.window.Eval(command)
+	// AddScript runs the script as soon as it is appended to the document,
+	// so the native eval callback firing means the script has completed
+	result := make(chan error, 1)
+	command := fmt.Sprintf("wails._.AddScript('%s')", minified)
+	w.window.Dispatch(func() {
+		// Backends that evaluate synchronously run the callback before
+		// EvalWithCallback returns, so its error is only known afterwards.
+		// Both run on the main thread, so exactly one result is sent.
+		returned := false
+		completed := false
+		err := w.window.EvalWithCallback(command, func(string, bool) {
+			if !returned {
+				completed = true
+				return
+			}
+			result <- nil
 		})
-		for exit == false {
-			time.Sleep(time.Millisecond * 1)
+		returned = true
+		if err != nil {
+			result <- err
+		} else if completed {
+			result <- nil
 		}
-	}()
-
-	wg.Wait()
+	})
 
-	return nil
+	return <-result
 }
 
 // injectCSS adds the given CSS to the WebView
@@ -365,6 +361,13 @@ func (w *WebView) callback(data string) error {
 	return w.evalJS(callbackCMD)
 }
 
+// notifyBuffers holds the buffers used to build Notify scripts
+var notifyBuffers = sync.Pool{
+	New: func() interface{} {
+		return new(bytes.Buffer)
+	},
+}
+
 // NotifyEvent notifies the frontend about a backend runtime event
 func (w *WebView) NotifyEvent(event *messages.EventData) error {
 
@@ -376,28 +379,32 @@ func (w *WebView) NotifyEvent(event *messages.EventData) error {
 		return err
 	}
 
-	// Default data is a blank array
-	data := []byte("[]")
+	message := notifyBuffers.Get().(*bytes.Buffer)
+	defer notifyBuffers.Put(message)
+	message.Reset()
 
-	// Process event data
+	message.WriteString("window.wails._.Notify('")
+	message.WriteString(wv.EscapeJS(event.Name))
+	message.WriteString("',")
+
+	// The marshalled data is embedded as a JS literal. encoding/json
+	// escapes <, >, &, U+2028 and U+2029, so its output is always a safe
+	// expression. Default data is a blank array.
 	if event.Data != nil {
-		// Marshall the data
-		data, err = json.Marshal(event.Data)
+		encoder := json.NewEncoder(message)
+		err = encoder.Encode(event.Data)
 		if err != nil {
-			w.log.Errorf("Cannot unmarshall JSON data in event: %s ", err.Error())
+			w.log.Errorf("Cannot marshal JSON data in event: %s ", err.Error())
 			return err
 		}
+		// Drop the newline Encode adds
+		message.Truncate(message.Len() - 1)
+	} else {
+		message.WriteString("[]")
 	}
+	message.WriteByte(')')
 
-	// Double encode data to ensure everything is escaped correctly.
-	data, err = json.Marshal(string(data))
-	if err != nil {
-		w.log.Errorf("Cannot marshal JSON data in event: %s ", err.Error())
-		return err
-	}
-
-	message := "window.wails._.Notify('" + event.Name + "'," + string(data) + ")"
-	return w.evalJS(message)
+	return w.evalJS(message.String())
 }
 
 // SetMinSize sets the minimum size of a resizable window
@@ -0,0 +1,17 @@
+//go:build go1.18
+// +build go1.18
+
+package webview
+
+import "testing"
+
+func FuzzEscapeJSMatchesNative(f *testing.F) {
+	for _, seed := range []string{"", "plain", `'"\<>`, "\u2028\u2029", "\xe2\x80\xa8", "héllo\n世界", "\xff\xfe"} {
+		f.Add(seed)
+	}
+	f.Fuzz(func(t *testing.T, input string) {
+		if got, want := EscapeJS(input), escapeJSNative(input); got != want {
+			t.Fatalf("EscapeJS(%q) = %q, native = %q", input, got, want)
+		}
+	})
+}
@@ -0,0 +1,75 @@
+package webview
+
+import (
+	"encoding/json"
+	"strings"
+	"testing"
+)
+
+func TestEscapeJS(t *testing.T) {
+	tests := []struct {
+		input string
+		want  string
+	}{
+		{"", ""},
+		{"plain text", "plain text"},
+		{"it's", `it\x27s`},
+		{`say "hi"`, `say \x22hi\x22`},
+		{`C:\path`, `C:\x5cpath`},
+		{"</style>", `\x3c/style\x3e`},
+		{"line\nbreak\r\ttab", `line\x0abreak\x0d\x09tab`},
+		{"sep\u2028para\u2029", `sep\u2028para\u2029`},
+		{"héllo → 世界", "héllo → 世界"},
+		{"\xe2\x80", "\xe2\x80"},
+	}
+	for _, tt := range tests {
+		if got := EscapeJS(tt.input); got != tt.want {
+			t.Errorf("EscapeJS(%q) = %q, want %q", tt.input, got, tt.want)
+		}
+		if got := escapeJSNative(tt.input); got != tt.want {
+			t.Errorf("webview_js_encode(%q) = %q, want %q", tt.input, got, tt.want)
+		}
+	}
+}
+
+func TestEscapeJSMatchesNative(t *testing.T) {
+	// Place each byte at every offset within a word so both word-at-a-time
+	// scanners are exercised
+	for c := 0; c < 256; c++ {
+		for offset := 0; offset < 16; offset++ {
+			input := strings.Repeat("a", offset) + string([]byte{byte(c)}) + "\x80\xa8" + strings.Repeat("b", 16)
+			if got, want := EscapeJS(input), escapeJSNative(input); got != want {
+				t.Fatalf("EscapeJS(%q) = %q, native = %q", input, got, want)
+			}
+		}
+	}
+}
+
+func benchmarkPayload() string {
+	data := make([]string, 0, 16384)
+	for len(data) < cap(data) {
+		data = append(data, `user's "item" <42> with unicode 世界 and plain ascii text`)
+	}
+	payload, _ := json.Marshal(map[string]interface{}{"name": "bench", "data": data})
+	return string(payload[:1<<20])
+}
+
+func BenchmarkEscapeJS(b *testing.B) {
+	payload := benchmarkPayload()
+	b.SetBytes(int64(len(payload)))
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		EscapeJS(payload)
+	}
+}
+
+// BenchmarkEscapeJSNative includes the cost of copying to and from C memory
+func BenchmarkEscapeJSNative(b *testing.B) {
+	payload := benchmarkPayload()
+	b.SetBytes(int64(len(payload)))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		escapeJSNative(payload)
+	}
+}
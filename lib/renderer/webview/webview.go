@@ -95,6 +95,20 @@ static inline int CgoWebViewEval(void *w, char *js) {
 	return webview_eval((struct webview *)w, js);
 }
 
+extern void _webviewEvalGoCallback(void *, char *);
+static inline void _webview_eval_cb(struct webview *w, const char *result, void *arg) {
+	_webviewEvalGoCallback(arg, (char *)result);
+}
+static inline int CgoWebViewEvalAsync(void *w, char *js, uintptr_t arg) {
+	return webview_eval_async((struct webview *)w, js, _webview_eval_cb, (void *)arg);
+}
+
+static inline char *CgoWebViewJSEncode(char *s, size_t len, size_t *outlen) {
+	char *esc = (char *)malloc(4 * len + 1);
+	*outlen = webview_js_encode(s, len, esc);
+	return esc;
+}
+
 static inline void CgoWebViewInjectCSS(void *w, char *css) {
 	webview_inject_css((struct webview *)w, css);
 }
@@ -152,6 +166,10 @@ func Open(title, url string, w, h int, resizable bool) error {
 // string can be used.
 type ExternalInvokeCallbackFunc func(w WebView, data string)
 
+// EvalCallbackFunc is called once a script passed to EvalWithCallback() has
+// been evaluated.
+type EvalCallbackFunc func(result string, ok bool)
+
 // Settings is a set of parameters to customize the initial WebView appearance
 // and behavior. It is passed into the webview.New() constructor.
 type Settings struct {
@@ -201,6 +219,12 @@ type WebView interface {
 	// Eval() evaluates an arbitrary JS code inside the webview. This method must
 	// be called from the main thread only. See Dispatch() for more details.
 	Eval(js string) error
+	// EvalWithCallback() evaluates JS code like Eval() but does not wait for
+	// it to run. The callback is invoked on the main thread with the script's
+	// completion value once it has. ok is false if the evaluation failed or
+	// the platform cannot report results. This method must be called from the
+	// main thread only. See Dispatch() for more details.
+	EvalWithCallback(js string, callback EvalCallbackFunc) error
 	// InjectJS() injects an arbitrary block of CSS code using the JS API. This
 	// method must be called from the main thread only. See Dispatch() for more
 	// details.
@@ -247,10 +271,12 @@ const (
 )
 
 var (
-	m     sync.Mutex
-	index uintptr
-	fns   = map[uintptr]func(){}
-	cbs   = map[WebView]ExternalInvokeCallbackFunc{}
+	m         sync.Mutex
+	index     uintptr
+	fns       = map[uintptr]func(){}
+	cbs       = map[WebView]ExternalInvokeCallbackFunc{}
+	evalIndex uintptr
+	evalCbs   = map[uintptr]EvalCallbackFunc{}
 )
 
 type webview struct {
@@ -370,12 +396,41 @@ func (w *webview) Eval(js string) error {
 	return nil
 }
 
+func (w *webview) EvalWithCallback(js string, callback EvalCallbackFunc) error {
+	// IDs are never reused so a late completion can't resolve a newer eval
+	m.Lock()
+	evalIndex++
+	id := evalIndex
+	evalCbs[id] = callback
+	m.Unlock()
+	p := C.CString(js)
+	defer C.free(unsafe.Pointer(p))
+	if C.CgoWebViewEvalAsync(w.w, p, C.uintptr_t(id)) == -1 {
+		m.Lock()
+		delete(evalCbs, id)
+		m.Unlock()
+		return errors.New("evaluation failed")
+	}
+	return nil
+}
+
 func (w *webview) InjectCSS(css string) {
 	p := C.CString(css)
 	defer C.free(unsafe.Pointer(p))
 	C.CgoWebViewInjectCSS(w.w, p)
 }
 
+// escapeJSNative runs webview_js_encode over s. It lets the tests check that
+// EscapeJS and the native escaper agree.
+func escapeJSNative(s string) string {
+	p := C.CString(s)
+	defer C.free(unsafe.Pointer(p))
+	var n C.size_t
+	esc := C.CgoWebViewJSEncode(p, C.size_t(len(s)), &n)
+	defer C.free(unsafe.Pointer(esc))
+	return C.GoStringN(esc, C.int(n))
+}
+
 func (w *webview) Terminate() {
 	C.CgoWebViewTerminate(w.w)
 }
@@ -392,6 +447,18 @@ func _webviewDispatchGoCallback(index unsafe.Pointer) {
 	}
 }
 
+//export _webviewEvalGoCallback
+func _webviewEvalGoCallback(index unsafe.Pointer, result *C.char) {
+	var f EvalCallbackFunc
+	m.Lock()
+	f = evalCbs[uintptr(index)]
+	delete(evalCbs, uintptr(index))
+	m.Unlock()
+	if f != nil {
+		f(C.GoString(result), result != nil)
+	}
+}
+
 //export _webviewExternalInvokeCallback
 func _webviewExternalInvokeCallback(w unsafe.Pointer, data unsafe.Pointer) {
 	m.Lock()
@@ -43,6 +43,12 @@ extern "C"
 #include <JavaScriptCore/JavaScript.h>
 #include <gtk/gtk.h>
 #include <webkit2/webkit2.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
+
+  struct webview_dispatch_arg;
 
   struct webview_priv
   {
@@ -50,9 +56,14 @@ extern "C"
     GtkWidget *scroller;
     GtkWidget *webview;
     GtkWidget *inspector_window;
-    GAsyncQueue *queue;
+    struct webview_dispatch_arg *dispatch_head;
+    struct webview_dispatch_arg *dispatch_tail;
+    struct webview_dispatch_arg *dispatch_stub;
+    GSource *dispatch_source;
+    int dispatch_fds[2];
+    int dispatch_signalled;
+    GQueue *pending_evals;
     int ready;
-    int js_busy;
     int should_exit;
 
     int min_width;
@@ -144,8 +155,15 @@ struct webview_priv
     webview_dispatch_fn fn;
     struct webview *w;
     void *arg;
+    struct webview_dispatch_arg *next;
   };
 
+  /* Called on the main thread once an asynchronous evaluation completes.
+   * result is the script's completion value converted to a string, or NULL
+   * if the evaluation failed. It is only valid for the duration of the call. */
+  typedef void (*webview_eval_cb_t)(struct webview *w, const char *result,
+                                    void *arg);
+
 #define DEFAULT_URL                                                            \
   "data:text/"                                                                 \
   "html,%3C%21DOCTYPE%20html%3E%0A%3Chtml%20lang=%22en%22%3E%0A%3Chead%3E%"    \
@@ -176,6 +194,8 @@ struct webview_priv
   WEBVIEW_API int webview_init(struct webview *w);
   WEBVIEW_API int webview_loop(struct webview *w, int blocking);
   WEBVIEW_API int webview_eval(struct webview *w, const char *js);
+  WEBVIEW_API int webview_eval_async(struct webview *w, const char *js,
+                                     webview_eval_cb_t cb, void *arg);
   WEBVIEW_API int webview_inject_css(struct webview *w, const char *css);
   WEBVIEW_API void webview_set_title(struct webview *w, const char *title);
   WEBVIEW_API void webview_focus(struct webview *w);
@@ -230,54 +250,151 @@ struct webview_priv
     va_end(ap);
   }
 
-  static int webview_js_encode(const char *s, char *esc, size_t n)
+#define WEBVIEW_SWAR_ONES 0x0101010101010101ULL
+#define WEBVIEW_SWAR_HIGHS 0x8080808080808080ULL
+#define WEBVIEW_SWAR_HAS_ZERO(x)                                               \
+  ((((x)-WEBVIEW_SWAR_ONES) & ~(x)&WEBVIEW_SWAR_HIGHS) != 0)
+#define WEBVIEW_SWAR_HAS_BYTE(x, c)                                            \
+  WEBVIEW_SWAR_HAS_ZERO((x) ^ (WEBVIEW_SWAR_ONES * (uint64_t)(c)))
+#define WEBVIEW_SWAR_HAS_LESS(x, n)                                            \
+  ((((x)-WEBVIEW_SWAR_ONES * (uint64_t)(n)) & ~(x)&WEBVIEW_SWAR_HIGHS) != 0)
+
+  /* Bytes that may need escaping. 0xE2 is the lead byte of U+2028 and
+   * U+2029 and is confirmed by the caller. */
+  static int webview_js_candidate(unsigned char c)
+  {
+    return c < 0x20 || c == '"' || c == '\'' || c == '\\' || c == '<' ||
+           c == '>' || c == 0xE2;
+  }
+
+  /* Returns the index of the next candidate byte at or after i, or len.
+   * Input is tested eight bytes at a time; the tests are exact, so a word
+   * that matches always contains a candidate. */
+  static size_t webview_js_next_escape(const char *s, size_t len, size_t i)
   {
-    int r = 1; /* At least one byte for trailing zero */
-    for (; *s; s++)
+    for (; i + 8 <= len; i += 8)
     {
-      const unsigned char c = *s;
-      if (c >= 0x20 && c < 0x80 && strchr("<>\\'\"", c) == NULL)
+      uint64_t x;
+      memcpy(&x, s + i, sizeof(x));
+      if (WEBVIEW_SWAR_HAS_LESS(x, 0x20) || WEBVIEW_SWAR_HAS_BYTE(x, '"') ||
+          WEBVIEW_SWAR_HAS_BYTE(x, '\'') || WEBVIEW_SWAR_HAS_BYTE(x, '\\') ||
+          WEBVIEW_SWAR_HAS_BYTE(x, '<') || WEBVIEW_SWAR_HAS_BYTE(x, '>') ||
+          WEBVIEW_SWAR_HAS_BYTE(x, 0xE2))
       {
-        if (n > 0)
+        while (!webview_js_candidate((unsigned char)s[i]))
         {
-          *esc++ = c;
-          n--;
+          i++;
         }
-        r++;
+        return i;
       }
-      else
+    }
+    for (; i < len; i++)
+    {
+      if (webview_js_candidate((unsigned char)s[i]))
       {
-        if (n > 0)
+        return i;
+      }
+    }
+    return len;
+  }
+
+  /* Escapes len bytes of s for use inside a quoted JavaScript string literal,
+   * writing the result and a trailing zero to esc, which must have room for
+   * 4 * len + 1 bytes. Control characters, quotes, backslashes and angle
+   * brackets become \xNN, U+2028 and U+2029 become \u2028 and \u2029, and
+   * all other bytes, including UTF-8 sequences, are copied as is. Returns the
+   * length of the escaped string. EscapeJS in webview.go is the Go
+   * equivalent and must produce identical output. */
+  static size_t webview_js_encode(const char *s, size_t len, char *esc)
+  {
+    static const char hex[] = "0123456789abcdef";
+    char *out = esc;
+    size_t last = 0;
+    size_t i = webview_js_next_escape(s, len, 0);
+    while (i < len)
+    {
+      const unsigned char c = s[i];
+      if (c == 0xE2)
+      {
+        if (i + 2 < len && (unsigned char)s[i + 1] == 0x80 &&
+            ((unsigned char)s[i + 2] == 0xA8 || (unsigned char)s[i + 2] == 0xA9))
         {
-          snprintf(esc, n, "\\x%02x", (int)c);
-          esc += 4;
-          n -= 4;
+          memcpy(out, s + last, i - last);
+          out += i - last;
+          const char *sep = (unsigned char)s[i + 2] == 0xA8 ? "\\u2028" : "\\u2029";
+          memcpy(out, sep, 6);
+          out += 6;
+          i += 3;
+          last = i;
         }
-        r += 4;
+        else
+        {
+          i++;
+        }
+      }
+      else
+      {
+        memcpy(out, s + last, i - last);
+        out += i - last;
+        *out++ = '\\';
+        *out++ = 'x';
+        *out++ = hex[c >> 4];
+        *out++ = hex[c & 0x0f];
+        i++;
+        last = i;
       }
+      i = webview_js_next_escape(s, len, i);
     }
-    return r;
+    memcpy(out, s + last, len - last);
+    out += len - last;
+    *out = '\0';
+    return (size_t)(out - esc);
   }
 
   WEBVIEW_API int webview_inject_css(struct webview *w, const char *css)
   {
-    int n = webview_js_encode(css, NULL, 0);
-    char *esc = (char *)calloc(1, sizeof(CSS_INJECT_FUNCTION) + n + 4);
-    if (esc == NULL)
+    size_t prefix = sizeof(CSS_INJECT_FUNCTION) - 1;
+    size_t len = strlen(css);
+    /* CSS_INJECT_FUNCTION("<escaped css>") */
+    char *js = (char *)malloc(prefix + 4 * len + 5);
+    if (js == NULL)
     {
       return -1;
     }
-    char *js = (char *)calloc(1, n);
-    webview_js_encode(css, js, n);
-    snprintf(esc, sizeof(CSS_INJECT_FUNCTION) + n + 4, "%s(\"%s\")",
-             CSS_INJECT_FUNCTION, js);
-    int r = webview_eval(w, esc);
+    char *p = js;
+    memcpy(p, CSS_INJECT_FUNCTION, prefix);
+    p += prefix;
+    *p++ = '(';
+    *p++ = '"';
+    p += webview_js_encode(css, len, p);
+    *p++ = '"';
+    *p++ = ')';
+    *p = '\0';
+    int r = webview_eval(w, js);
     free(js);
-    free(esc);
     return r;
   }
 
+#if !defined(WEBVIEW_GTK)
+  /* Only the GTK backend evaluates scripts asynchronously. Elsewhere the
+   * script has already run by the time webview_eval returns, so the callback
+   * is invoked straight away without a result. */
+  WEBVIEW_API int webview_eval_async(struct webview *w, const char *js,
+                                     webview_eval_cb_t cb, void *arg)
+  {
+    int r = webview_eval(w, js);
+    if (cb != NULL)
+    {
+      cb(w, NULL, arg);
+    }
+    return r;
+  }
+#endif
+
 #if defined(WEBVIEW_GTK)
+  static void webview_flush_pending_evals(struct webview *w);
+  static int webview_dispatch_init(struct webview *w);
+
   static void external_message_received_cb(WebKitUserContentManager *m,
                                            WebKitJavascriptResult *r,
                                            gpointer arg)
@@ -307,6 +424,7 @@ struct webview_priv
     if (event == WEBKIT_LOAD_FINISHED)
     {
       w->priv.ready = 1;
+      webview_flush_pending_evals(w);
     }
   }
 
@@ -340,7 +458,11 @@ struct webview_priv
 
     w->priv.ready = 0;
     w->priv.should_exit = 0;
-    w->priv.queue = g_async_queue_new();
+    if (webview_dispatch_init(w) != 0)
+    {
+      return -1;
+    }
+    w->priv.pending_evals = g_queue_new();
     w->priv.window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
 
     w->priv.min_width = -1;
@@ -549,63 +671,232 @@ struct webview_priv
     }
   }
 
+  struct webview_eval_arg
+  {
+    struct webview *w;
+    webview_eval_cb_t cb;
+    void *arg;
+    char *js;
+  };
+
   static void webview_eval_finished(GObject *object, GAsyncResult *result,
                                     gpointer userdata)
   {
-    (void)object;
-    (void)result;
-    struct webview *w = (struct webview *)userdata;
-    w->priv.js_busy = 0;
+    struct webview_eval_arg *context = (struct webview_eval_arg *)userdata;
+    char *s = NULL;
+    WebKitJavascriptResult *r = webkit_web_view_run_javascript_finish(
+        WEBKIT_WEB_VIEW(object), result, NULL);
+    if (r != NULL)
+    {
+      JSGlobalContextRef ctx = webkit_javascript_result_get_global_context(r);
+      JSValueRef value = webkit_javascript_result_get_value(r);
+      JSStringRef js = JSValueToStringCopy(ctx, value, NULL);
+      if (js != NULL)
+      {
+        size_t n = JSStringGetMaximumUTF8CStringSize(js);
+        s = g_new(char, n);
+        JSStringGetUTF8CString(js, s, n);
+        JSStringRelease(js);
+      }
+      webkit_javascript_result_unref(r);
+    }
+    context->cb(context->w, s, context->arg);
+    g_free(s);
+    g_free(context);
   }
 
-  WEBVIEW_API int webview_eval(struct webview *w, const char *js)
+  /* Hands the script to WebKit without waiting for it to run. WebKit copies
+   * the source and executes scripts in submission order, so any number of
+   * evaluations may be in flight at once. */
+  static void webview_run_javascript(struct webview *w, const char *js,
+                                     webview_eval_cb_t cb, void *arg)
   {
-    while (w->priv.ready == 0)
+    if (cb == NULL)
     {
-      g_main_context_iteration(NULL, TRUE);
+      webkit_web_view_run_javascript(WEBKIT_WEB_VIEW(w->priv.webview), js,
+                                     NULL, NULL, NULL);
+      return;
     }
-    w->priv.js_busy = 1;
+    struct webview_eval_arg *context = g_new(struct webview_eval_arg, 1);
+    context->w = w;
+    context->cb = cb;
+    context->arg = arg;
+    context->js = NULL;
     webkit_web_view_run_javascript(WEBKIT_WEB_VIEW(w->priv.webview), js, NULL,
-                                   webview_eval_finished, w);
-    while (w->priv.js_busy)
+                                   webview_eval_finished, context);
+  }
+
+  static void webview_flush_pending_evals(struct webview *w)
+  {
+    struct webview_eval_arg *pending;
+    while ((pending = (struct webview_eval_arg *)g_queue_pop_head(
+                w->priv.pending_evals)) != NULL)
+    {
+      webview_run_javascript(w, pending->js, pending->cb, pending->arg);
+      g_free(pending->js);
+      g_free(pending);
+    }
+  }
+
+  WEBVIEW_API int webview_eval_async(struct webview *w, const char *js,
+                                     webview_eval_cb_t cb, void *arg)
+  {
+    if (w->priv.ready == 0 ||
+        g_queue_is_empty(w->priv.pending_evals) == FALSE)
     {
-      g_main_context_iteration(NULL, TRUE);
+      /* Scripts submitted before the page has loaded are held back and
+       * flushed in order from webview_load_changed_cb */
+      struct webview_eval_arg *pending = g_new(struct webview_eval_arg, 1);
+      pending->w = w;
+      pending->cb = cb;
+      pending->arg = arg;
+      pending->js = g_strdup(js);
+      g_queue_push_tail(w->priv.pending_evals, pending);
+      return 0;
     }
+    webview_run_javascript(w, js, cb, arg);
     return 0;
   }
 
-  static gboolean webview_dispatch_wrapper(gpointer userdata)
+  WEBVIEW_API int webview_eval(struct webview *w, const char *js)
   {
-    struct webview *w = (struct webview *)userdata;
-    for (;;)
+    return webview_eval_async(w, js, NULL, NULL);
+  }
+
+  /* Dispatched calls go through an intrusive multi-producer/single-consumer
+   * queue (Vyukov). Pushing is a single atomic exchange, so producers never
+   * take a lock or contend with the main thread. Only the push that finds
+   * the queue idle signals the wakeup fd, and the main thread drains
+   * everything queued each time it wakes. */
+  static void webview_dispatch_push(struct webview *w,
+                                    struct webview_dispatch_arg *node)
+  {
+    __atomic_store_n(&node->next, NULL, __ATOMIC_RELAXED);
+    struct webview_dispatch_arg *prev = __atomic_exchange_n(
+        &w->priv.dispatch_head, node, __ATOMIC_ACQ_REL);
+    __atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+  }
+
+  /* Returns NULL when the queue is empty, or when a producer is midway
+   * through a push. That producer signals the wakeup fd after linking its
+   * node, so it is picked up on the next wakeup. */
+  static struct webview_dispatch_arg *webview_dispatch_pop(struct webview *w)
+  {
+    struct webview_dispatch_arg *tail = w->priv.dispatch_tail;
+    struct webview_dispatch_arg *next =
+        __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+    if (tail == w->priv.dispatch_stub)
     {
-      struct webview_dispatch_arg *arg =
-          (struct webview_dispatch_arg *)g_async_queue_try_pop(w->priv.queue);
-      if (arg == NULL)
+      if (next == NULL)
       {
-        break;
+        return NULL;
       }
+      w->priv.dispatch_tail = next;
+      tail = next;
+      next = __atomic_load_n(&next->next, __ATOMIC_ACQUIRE);
+    }
+    if (next != NULL)
+    {
+      w->priv.dispatch_tail = next;
+      return tail;
+    }
+    if (tail != __atomic_load_n(&w->priv.dispatch_head, __ATOMIC_ACQUIRE))
+    {
+      return NULL;
+    }
+    webview_dispatch_push(w, w->priv.dispatch_stub);
+    next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+    if (next != NULL)
+    {
+      w->priv.dispatch_tail = next;
+      return tail;
+    }
+    return NULL;
+  }
+
+  static void webview_dispatch_signal(struct webview *w)
+  {
+    if (__atomic_exchange_n(&w->priv.dispatch_signalled, 1,
+                            __ATOMIC_SEQ_CST) == 0)
+    {
+      uint64_t one = 1;
+      ssize_t r = write(w->priv.dispatch_fds[1], &one, sizeof(one));
+      (void)r;
+    }
+  }
+
+  struct webview_dispatch_source
+  {
+    GSource source;
+    struct webview *w;
+  };
+
+  static gboolean webview_dispatch_source_cb(GSource *source,
+                                             GSourceFunc callback,
+                                             gpointer userdata)
+  {
+    (void)callback;
+    (void)userdata;
+    struct webview *w = ((struct webview_dispatch_source *)source)->w;
+    uint64_t count;
+    ssize_t r = read(w->priv.dispatch_fds[0], &count, sizeof(count));
+    (void)r;
+    /* Clear the flag before draining so a push that lands after we have
+     * looked at the queue raises a fresh wakeup */
+    __atomic_store_n(&w->priv.dispatch_signalled, 0, __ATOMIC_SEQ_CST);
+    struct webview_dispatch_arg *arg;
+    while ((arg = webview_dispatch_pop(w)) != NULL)
+    {
       (arg->fn)(w, arg->arg);
       g_free(arg);
     }
-    return FALSE;
+    return G_SOURCE_CONTINUE;
+  }
+
+  static GSourceFuncs webview_dispatch_source_funcs = {
+      NULL, NULL, webview_dispatch_source_cb, NULL, NULL, NULL};
+
+  static int webview_dispatch_init(struct webview *w)
+  {
+#if defined(__linux__)
+    int fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (fd < 0)
+    {
+      return -1;
+    }
+    w->priv.dispatch_fds[0] = fd;
+    w->priv.dispatch_fds[1] = fd;
+#else
+    if (pipe(w->priv.dispatch_fds) != 0)
+    {
+      return -1;
+    }
+#endif
+    w->priv.dispatch_signalled = 0;
+    w->priv.dispatch_stub = g_new0(struct webview_dispatch_arg, 1);
+    w->priv.dispatch_head = w->priv.dispatch_stub;
+    w->priv.dispatch_tail = w->priv.dispatch_stub;
+
+    w->priv.dispatch_source = g_source_new(
+        &webview_dispatch_source_funcs, sizeof(struct webview_dispatch_source));
+    ((struct webview_dispatch_source *)w->priv.dispatch_source)->w = w;
+    g_source_add_unix_fd(w->priv.dispatch_source, w->priv.dispatch_fds[0],
+                         G_IO_IN);
+    /* Keep dispatching while a modal dialog runs a nested main loop */
+    g_source_set_can_recurse(w->priv.dispatch_source, TRUE);
+    g_source_attach(w->priv.dispatch_source, NULL);
+    return 0;
   }
 
   WEBVIEW_API void webview_dispatch(struct webview *w, webview_dispatch_fn fn,
                                     void *arg)
   {
-    struct webview_dispatch_arg *context =
-        (struct webview_dispatch_arg *)g_new(struct webview_dispatch_arg *, 1);
+    struct webview_dispatch_arg *context = g_new(struct webview_dispatch_arg, 1);
     context->w = w;
     context->arg = arg;
     context->fn = fn;
-    g_async_queue_lock(w->priv.queue);
-    g_async_queue_push_unlocked(w->priv.queue, context);
-    if (g_async_queue_length_unlocked(w->priv.queue) == 1)
-    {
-      gdk_threads_add_idle(webview_dispatch_wrapper, w);
-    }
-    g_async_queue_unlock(w->priv.queue);
+    webview_dispatch_push(w, context);
+    webview_dispatch_signal(w);
   }
 
   WEBVIEW_API void webview_terminate(struct webview *w)
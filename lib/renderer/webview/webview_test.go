@@ -0,0 +1,162 @@
+// +build linux
+
+package webview
+
+import (
+	"os"
+	"strconv"
+	"sync"
+	"testing"
+	"time"
+)
+
+// GTK must be driven from the thread that initialised it, which is the main
+// thread locked in init(). TestMain creates the window there and keeps its
+// loop running while the tests and benchmarks talk to it through Dispatch().
+// Run with a display available, eg: xvfb-run go test -bench . -run XXX
+var testView WebView
+
+func TestMain(m *testing.M) {
+	if os.Getenv("DISPLAY") == "" {
+		os.Exit(m.Run())
+	}
+	testView = NewWebview(Settings{Title: "webview_test", Width: 320, Height: 240})
+	if testView == nil {
+		os.Exit(m.Run())
+	}
+	result := make(chan int, 1)
+	go func() {
+		result <- m.Run()
+	}()
+	for {
+		select {
+		case code := <-result:
+			os.Exit(code)
+		default:
+			testView.Loop(false)
+			time.Sleep(100 * time.Microsecond)
+		}
+	}
+}
+
+func requireView(tb testing.TB) {
+	if testView == nil {
+		tb.Skip("No display available")
+	}
+}
+
+func TestEvalWithCallbackResult(t *testing.T) {
+	requireView(t)
+	type evalResult struct {
+		result string
+		ok     bool
+	}
+	results := make(chan evalResult, 1)
+	testView.Dispatch(func() {
+		testView.EvalWithCallback("6 * 7", func(result string, ok bool) {
+			results <- evalResult{result, ok}
+		})
+	})
+	select {
+	case r := <-results:
+		if !r.ok || r.result != "42" {
+			t.Fatalf("expected 42, got %q (ok = %t)", r.result, r.ok)
+		}
+	case <-time.After(10 * time.Second):
+		t.Fatal("timed out waiting for eval callback")
+	}
+}
+
+func TestEvalWithCallbackOrdering(t *testing.T) {
+	requireView(t)
+	const count = 1000
+	results := make(chan string, count)
+	testView.Dispatch(func() {
+		testView.Eval("window.evalCounter = 0")
+		for i := 0; i < count; i++ {
+			testView.EvalWithCallback("++window.evalCounter", func(result string, _ bool) {
+				results <- result
+			})
+		}
+	})
+	for i := 1; i <= count; i++ {
+		select {
+		case r := <-results:
+			if want := strconv.Itoa(i); r != want {
+				t.Fatalf("eval %d completed out of order: got %s", i, r)
+			}
+		case <-time.After(10 * time.Second):
+			t.Fatal("timed out waiting for eval callbacks")
+		}
+	}
+}
+
+// TestDispatchStress pushes 1M closures from 8 producers at once. Each
+// producer's closures must run exactly once and in the order it queued them.
+func TestDispatchStress(t *testing.T) {
+	requireView(t)
+	const producers = 8
+	const perProducer = 1000000 / producers
+
+	// Only the main thread touches next, so it needs no locking
+	var next [producers]int
+	var outOfOrder [producers]int
+	done := make(chan struct{})
+	remaining := producers * perProducer
+
+	var wg sync.WaitGroup
+	for p := 0; p < producers; p++ {
+		wg.Add(1)
+		go func(p int) {
+			defer wg.Done()
+			for i := 0; i < perProducer; i++ {
+				seq := i
+				testView.Dispatch(func() {
+					if next[p] != seq {
+						outOfOrder[p]++
+					}
+					next[p] = seq + 1
+					remaining--
+					if remaining == 0 {
+						close(done)
+					}
+				})
+			}
+		}(p)
+	}
+	wg.Wait()
+
+	select {
+	case <-done:
+	case <-time.After(60 * time.Second):
+		t.Fatal("timed out waiting for dispatched closures")
+	}
+	for p := 0; p < producers; p++ {
+		if outOfOrder[p] != 0 || next[p] != perProducer {
+			t.Errorf("producer %d: %d closures out of order, last seq %d", p, outOfOrder[p], next[p]-1)
+		}
+	}
+}
+
+// BenchmarkEvalThroughput submits b.N scripts in one go and waits for the last
+// completion, reporting how many evaluations per second the webview sustains.
+func BenchmarkEvalThroughput(b *testing.B) {
+	requireView(b)
+	done := make(chan struct{})
+	start := time.Now()
+	b.ResetTimer()
+	testView.Dispatch(func() {
+		remaining := b.N
+		for i := 0; i < b.N; i++ {
+			testView.EvalWithCallback("void 0", func(string, bool) {
+				remaining--
+				if remaining == 0 {
+					close(done)
+				}
+			})
+		}
+	})
+	<-done
+	b.StopTimer()
+	b.ReportMetric(float64(b.N)/time.Since(start).Seconds(), "evals/s")
+}
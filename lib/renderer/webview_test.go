@@ -0,0 +1,236 @@
+package renderer
+
+import (
+	"encoding/json"
+	"errors"
+	"reflect"
+	"strings"
+	"testing"
+
+	"github.com/wailsapp/wails/lib/logger"
+	"github.com/wailsapp/wails/lib/messages"
+	wv "github.com/wailsapp/wails/lib/renderer/webview"
+)
+
+// fakeWindow stands in for the native window. Dispatched functions and eval
+// completions run in order on a single goroutine, like the GTK main loop.
+type fakeWindow struct {
+	wv.WebView
+	mainThread chan func()
+	scripts    []string
+
+	// Evaluate like the non-GTK backends: run the callback straight away,
+	// then return evalErr
+	synchronous bool
+	evalErr     error
+}
+
+func newFakeWindow() *fakeWindow {
+	f := &fakeWindow{mainThread: make(chan func(), 64)}
+	go func() {
+		for fn := range f.mainThread {
+			fn()
+		}
+	}()
+	return f
+}
+
+func (f *fakeWindow) Dispatch(fn func()) {
+	f.mainThread <- fn
+}
+
+func (f *fakeWindow) EvalWithCallback(js string, callback wv.EvalCallbackFunc) error {
+	f.scripts = append(f.scripts, js)
+	if f.synchronous {
+		callback("", false)
+		return f.evalErr
+	}
+	go f.Dispatch(func() {
+		callback("", true)
+	})
+	return nil
+}
+
+func (f *fakeWindow) Eval(js string) error {
+	f.scripts = append(f.scripts, js)
+	return nil
+}
+
+// flush waits for everything dispatched so far to run
+func (f *fakeWindow) flush() {
+	done := make(chan struct{})
+	f.Dispatch(func() { close(done) })
+	<-done
+}
+
+func newTestWebView() (*WebView, *fakeWindow) {
+	window := newFakeWindow()
+	return &WebView{
+		window: window,
+		log:    logger.NewCustomLogger("WebView"),
+	}, window
+}
+
+func TestEvalJSSyncWaitsForCompletion(t *testing.T) {
+	w, window := newTestWebView()
+	defer close(window.mainThread)
+
+	for i := 0; i < 100; i++ {
+		if err := w.evalJSSync("window.test = 'it\\'s'"); err != nil {
+			t.Fatal(err)
+		}
+		// Reading scripts here without locking is safe only because
+		// evalJSSync returned after the main thread appended to it
+		if len(window.scripts) != i+1 {
+			t.Fatalf("expected %d scripts to have run, got %d", i+1, len(window.scripts))
+		}
+	}
+	if window.scripts[0] != `wails._.AddScript('window.test = \x27it\x5c\x27s\x27')` {
+		t.Fatalf("unexpected script: %s", window.scripts[0])
+	}
+}
+
+func TestEvalJSSyncSynchronousBackend(t *testing.T) {
+	w, window := newTestWebView()
+	defer close(window.mainThread)
+	window.synchronous = true
+
+	if err := w.evalJSSync("window.test = 1"); err != nil {
+		t.Fatal(err)
+	}
+	window.evalErr = errors.New("evaluation failed")
+	if err := w.evalJSSync("window.test = 2"); err != window.evalErr {
+		t.Fatalf("expected the evaluation error, got %v", err)
+	}
+}
+
+// BenchmarkEvalJSSync measures the round trip latency of sequential
+// synchronous evals, eg. binding injection at startup
+func BenchmarkEvalJSSync(b *testing.B) {
+	w, window := newTestWebView()
+	defer close(window.mainThread)
+
+	for n := 0; n < b.N; n++ {
+		for i := 0; i < 10000; i++ {
+			window.scripts = window.scripts[:0]
+			if err := w.evalJSSync("window.wails._.NewBinding('main.App.Method')"); err != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+}
+
+// checkNotifyScript splits a Notify script into its name and data and checks
+// that neither can break out of its position in the call
+func checkNotifyScript(t *testing.T, script string, name string, data interface{}) {
+	const prefix = "window.wails._.Notify('"
+	if !strings.HasPrefix(script, prefix) || !strings.HasSuffix(script, ")") {
+		t.Fatalf("malformed script: %s", script)
+	}
+	body := script[len(prefix) : len(script)-1]
+	end := strings.Index(body, "',")
+	if end == -1 {
+		t.Fatalf("malformed script: %s", script)
+	}
+	escapedName, literal := body[:end], body[end+2:]
+	for i := 0; i < len(escapedName); i++ {
+		switch c := escapedName[i]; {
+		case c == '\\':
+			if escapedName[i+1] != 'x' && escapedName[i+1] != 'u' {
+				t.Fatalf("unexpected escape in name: %s", escapedName)
+			}
+		case c < 0x20, c == '\'', c == '"', c == '<', c == '>':
+			t.Fatalf("unescaped %q in name: %s", c, escapedName)
+		}
+	}
+	if escapedName != wv.EscapeJS(name) {
+		t.Fatalf("name %q escaped to %s", name, escapedName)
+	}
+	// The literal must be exactly one JSON value, equal to the data
+	if !json.Valid([]byte(literal)) {
+		t.Fatalf("data is not a single JSON value: %s", literal)
+	}
+	if strings.ContainsAny(literal, "<>\u2028\u2029") {
+		t.Fatalf("data contains unescaped characters: %s", literal)
+	}
+	var got, want interface{}
+	if err := json.Unmarshal([]byte(literal), &got); err != nil {
+		t.Fatal(err)
+	}
+	expected, _ := json.Marshal(data)
+	json.Unmarshal(expected, &want)
+	if !reflect.DeepEqual(got, want) {
+		t.Fatalf("data decoded to %v, expected %v", got, want)
+	}
+}
+
+func TestNotifyEventHostile(t *testing.T) {
+	w, window := newTestWebView()
+	defer close(window.mainThread)
+
+	hostile := []string{
+		"plain",
+		"');alert(1);('",
+		"\\');alert(1);//",
+		"\\",
+		"name\nwith\r\nnewlines",
+		"\u2028');alert(1);//",
+		"</script><script>alert(1)</script>",
+		"\"double\" quoted",
+		"\x00nul",
+	}
+	for _, name := range hostile {
+		data := []interface{}{name, map[string]interface{}{"key": name, "nested": []interface{}{1.5, true, nil}}}
+		events := []*messages.EventData{
+			{Name: name, Data: data},
+			{Name: name, Data: name},
+			{Name: name},
+		}
+		for _, event := range events {
+			window.scripts = window.scripts[:0]
+			if err := w.NotifyEvent(event); err != nil {
+				t.Fatal(err)
+			}
+			window.flush()
+			if len(window.scripts) != 1 {
+				t.Fatalf("expected 1 script, got %d", len(window.scripts))
+			}
+			expected := event.Data
+			if expected == nil {
+				expected = []interface{}{}
+			}
+			checkNotifyScript(t, window.scripts[0], name, expected)
+		}
+	}
+}
+
+func TestNotifyEventUnmarshallable(t *testing.T) {
+	w, window := newTestWebView()
+	defer close(window.mainThread)
+
+	err := w.NotifyEvent(&messages.EventData{Name: "bad", Data: make(chan int)})
+	if err == nil {
+		t.Fatal("expected an error for unmarshallable data")
+	}
+	window.flush()
+	if len(window.scripts) != 0 {
+		t.Fatalf("expected no script to be run, got %v", window.scripts)
+	}
+}
+
+func BenchmarkNotifyEvent(b *testing.B) {
+	w, window := newTestWebView()
+	defer close(window.mainThread)
+	event := &messages.EventData{
+		Name: "progress",
+		Data: []interface{}{map[string]interface{}{"done": 42, "total": 100, "file": "some/path/to/file.txt"}},
+	}
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		w.NotifyEvent(event)
+		if i%1000 == 0 {
+			window.flush()
+			window.scripts = window.scripts[:0]
+		}
+	}
+}
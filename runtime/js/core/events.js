@@ -86,7 +86,7 @@ export function Once(eventName, callback) {
  *
  * @export
  * @param {string} eventName
- * @param {string} data
+ * @param {*} data - the event data, or a JSON string of it
  */
 export function Notify(eventName, data) {
 
@@ -102,9 +102,14 @@ export function Notify(eventName, data) {
 			// Get next listener
 			const listener = eventListeners[eventName][count];
 
-			// Parse data if we have it
+			// The webview renderer embeds the data directly, the bridge
+			// still sends it as a JSON string
 			var parsedData = [];
-			if (data) {
+			if (typeof data !== 'string') {
+				if (data != null) {
+					parsedData = data;
+				}
+			} else if (data) {
 				try {
 					parsedData = JSON.parse(data);
 				} catch (e) {
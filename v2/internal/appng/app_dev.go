@@ -34,6 +34,9 @@ type App struct {
 
 	menuManager *menumanager.Manager
 
+	// Events are shut down after the shutdown callback, which may emit them
+	events *runtime.Events
+
 	// Indicates if the app is in debug mode
 	debug bool
 
@@ -48,6 +51,7 @@ func (a *App) Run() error {
 	if a.shutdownCallback != nil {
 		a.shutdownCallback(a.ctx)
 	}
+	a.events.Shutdown()
 	return err
 }
 
@@ -162,6 +166,7 @@ func CreateApp(appoptions *options.App) (*App, error) {
 	}
 	eventHandler := runtime.NewEvents(myLogger)
 	ctx = context.WithValue(ctx, "events", eventHandler)
+	ctx = context.WithValue(ctx, "compactipc", appoptions.CompactIPC)
 	messageDispatcher := dispatcher.NewDispatcher(myLogger, appBindings, eventHandler)
 
 	// Create the frontends and register to event handler
@@ -175,6 +180,7 @@ func CreateApp(appoptions *options.App) (*App, error) {
 		frontend:         appFrontend,
 		logger:           myLogger,
 		menuManager:      menuManager,
+		events:           eventHandler,
 		startupCallback:  appoptions.OnStartup,
 		shutdownCallback: appoptions.OnShutdown,
 		debug:            true,
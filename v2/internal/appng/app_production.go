@@ -24,6 +24,9 @@ type App struct {
 
 	menuManager *menumanager.Manager
 
+	// Events are shut down after the shutdown callback, which may emit them
+	events *runtime.Events
+
 	// Indicates if the app is in debug mode
 	debug bool
 
@@ -38,6 +41,7 @@ func (a *App) Run() error {
 	if a.shutdownCallback != nil {
 		a.shutdownCallback(a.ctx)
 	}
+	a.events.Shutdown()
 	return err
 }
 
@@ -76,6 +80,7 @@ func CreateApp(appoptions *options.App) (*App, error) {
 	appBindings := binding.NewBindings(myLogger, appoptions.Bind, bindingExemptions)
 	eventHandler := runtime.NewEvents(myLogger)
 	ctx = context.WithValue(ctx, "events", eventHandler)
+	ctx = context.WithValue(ctx, "compactipc", appoptions.CompactIPC)
 	messageDispatcher := dispatcher.NewDispatcher(myLogger, appBindings, eventHandler)
 
 	debug := IsDebug()
@@ -96,6 +101,7 @@ func CreateApp(appoptions *options.App) (*App, error) {
 		frontend:         appFrontend,
 		logger:           myLogger,
 		menuManager:      menuManager,
+		events:           eventHandler,
 		startupCallback:  appoptions.OnStartup,
 		shutdownCallback: appoptions.OnShutdown,
 		debug:            debug,
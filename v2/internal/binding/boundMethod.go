@@ -10,6 +10,7 @@ import (
 // bound to the Wails application
 type BoundMethod struct {
 	Name     string        `json:"name"`
+	ID       int           `json:"id"`
 	Inputs   []*Parameter  `json:"inputs,omitempty"`
 	Outputs  []*Parameter  `json:"outputs,omitempty"`
 	Comments string        `json:"comments,omitempty"`
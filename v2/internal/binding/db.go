@@ -15,14 +15,23 @@ type DB struct {
 	// It used for performance gains at runtime
 	methodMap map[string]*BoundMethod
 
+	// Methods indexed by their ID. IDs start at 1 so that 0 can mean "no ID".
+	// They are assigned in the order methods are added, which is the same
+	// every time the app starts, and are sent to the frontend in ToJSON.
+	methodsByID []*BoundMethod
+
+	// The JSON of the store, made on the first call to ToJSON after a change
+	json string
+
 	// Lock to ensure sync access to the data
 	lock sync.RWMutex
 }
 
 func newDB() *DB {
 	return &DB{
-		store:     make(map[string]map[string]map[string]*BoundMethod),
-		methodMap: make(map[string]*BoundMethod),
+		store:       make(map[string]map[string]map[string]*BoundMethod),
+		methodMap:   make(map[string]*BoundMethod),
+		methodsByID: []*BoundMethod{nil},
 	}
 }
 
@@ -56,6 +65,19 @@ func (d *DB) GetMethod(qualifiedMethodName string) *BoundMethod {
 	return d.methodMap[qualifiedMethodName]
 }
 
+// GetMethodByID returns the method with the given ID or nil if there is none
+func (d *DB) GetMethodByID(id int) *BoundMethod {
+
+	// Lock the db whilst processing and unlock on return
+	d.lock.RLock()
+	defer d.lock.RUnlock()
+
+	if id <= 0 || id >= len(d.methodsByID) {
+		return nil
+	}
+	return d.methodsByID[id]
+}
+
 // AddMethod adds the given method definition to the db using the given qualified path: packageName.structName.methodName
 func (d *DB) AddMethod(packageName string, structName string, methodName string, methodDefinition *BoundMethod) {
 
@@ -86,19 +108,47 @@ func (d *DB) AddMethod(packageName string, structName string, methodName string,
 
 	// Store in the methodMap
 	key := packageName + "." + structName + "." + methodName
+
+	// Give it an ID, reusing the ID of any method it replaces
+	if existing := d.methodMap[key]; existing != nil {
+		methodDefinition.ID = existing.ID
+	} else {
+		methodDefinition.ID = len(d.methodsByID)
+		d.methodsByID = append(d.methodsByID, nil)
+	}
+	d.methodsByID[methodDefinition.ID] = methodDefinition
+
 	d.methodMap[key] = methodDefinition
 
+	// The JSON needs remaking
+	d.json = ""
+
 }
 
-// ToJSON converts the method map to JSON
+// ToJSON converts the method map to JSON. The bindings are fixed once the
+// app starts, so the JSON is made once and shared by every frontend.
 func (d *DB) ToJSON() (string, error) {
 
 	// Lock the db whilst processing and unlock on return
 	d.lock.RLock()
-	defer d.lock.RUnlock()
+	result := d.json
+	d.lock.RUnlock()
+	if result != "" {
+		return result, nil
+	}
+
+	d.lock.Lock()
+	defer d.lock.Unlock()
+	if d.json != "" {
+		return d.json, nil
+	}
 
 	bytes, err := json.Marshal(&d.store)
+	if err != nil {
+		return "", err
+	}
 
-	// Return zero copy string as this string will be read only
-	return *(*string)(unsafe.Pointer(&bytes)), err
+	// Zero copy string as this string will be read only
+	d.json = *(*string)(unsafe.Pointer(&bytes))
+	return d.json, nil
 }
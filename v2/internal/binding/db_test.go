@@ -0,0 +1,35 @@
+package binding
+
+import (
+	"testing"
+)
+
+func TestMethodIDs(t *testing.T) {
+	db := newDB()
+	names := []string{"Alpha", "Beta", "Gamma"}
+	for _, name := range names {
+		db.AddMethod("main", "App", name, &BoundMethod{Name: "main.App." + name})
+	}
+	for index, name := range names {
+		method := db.GetMethod("main.App." + name)
+		if method.ID != index+1 {
+			t.Errorf("%s: expected ID %d, got %d", name, index+1, method.ID)
+		}
+		if db.GetMethodByID(method.ID) != method {
+			t.Errorf("%s: lookup by ID returned a different method", name)
+		}
+	}
+
+	// Replacing a method keeps its ID
+	replacement := &BoundMethod{Name: "main.App.Beta"}
+	db.AddMethod("main", "App", "Beta", replacement)
+	if replacement.ID != 2 || db.GetMethodByID(2) != replacement {
+		t.Errorf("replaced method has ID %d", replacement.ID)
+	}
+
+	for _, id := range []int{-1, 0, 4} {
+		if db.GetMethodByID(id) != nil {
+			t.Errorf("expected no method for ID %d", id)
+		}
+	}
+}
@@ -0,0 +1,52 @@
+// Package cbytes encodes binary data as the body of a C array initialiser
+package cbytes
+
+// literals holds the decimal literal for each byte value, followed by a comma
+var literals [256]string
+
+func init() {
+	for value := range literals {
+		literals[value] = itoa(value) + ","
+	}
+}
+
+func itoa(value int) string {
+	if value < 10 {
+		return string(rune('0' + value))
+	}
+	return itoa(value/10) + string(rune('0'+value%10))
+}
+
+// EncodedLength returns the length of the encoding of data
+func EncodedLength(data []byte) int {
+	length := 2 * len(data)
+	for _, b := range data {
+		if b >= 10 {
+			length++
+			if b >= 100 {
+				length++
+			}
+		}
+	}
+	return length
+}
+
+// Append appends data to dst as comma separated C integer literals. Each
+// literal is followed by a comma, so more values may follow.
+func Append(dst []byte, data []byte) []byte {
+	if free := cap(dst) - len(dst); free < 4*len(data) {
+		grown := make([]byte, len(dst), len(dst)+EncodedLength(data))
+		copy(grown, dst)
+		dst = grown
+	}
+	for _, b := range data {
+		dst = append(dst, literals[b]...)
+	}
+	return dst
+}
+
+// String returns data as comma separated C integer literals, each followed by
+// a comma
+func String(data []byte) string {
+	return string(Append(make([]byte, 0, EncodedLength(data)), data))
+}
@@ -0,0 +1,55 @@
+package cbytes
+
+import (
+	"fmt"
+	"strings"
+	"testing"
+
+	"github.com/matryer/is"
+)
+
+func TestString(t *testing.T) {
+	is := is.New(t)
+
+	is.Equal(String(nil), "")
+	is.Equal(String([]byte{0, 9, 10, 99, 100, 255}), "0,9,10,99,100,255,")
+
+	var all []byte
+	var expected strings.Builder
+	for value := 0; value < 256; value++ {
+		all = append(all, byte(value))
+		expected.WriteString(fmt.Sprintf("%v,", value))
+	}
+	is.Equal(String(all), expected.String())
+	is.Equal(EncodedLength(all), expected.Len())
+}
+
+func TestAppend(t *testing.T) {
+	is := is.New(t)
+
+	result := Append([]byte("{ "), []byte("ab"))
+	result = Append(result, []byte{7})
+	is.Equal(string(result), "{ 97,98,7,")
+}
+
+func BenchmarkEncode(b *testing.B) {
+	data := make([]byte, 1024*1024)
+	for i := range data {
+		data[i] = byte(i * 31)
+	}
+	b.Run("sprintf", func(b *testing.B) {
+		b.SetBytes(int64(len(data)))
+		for i := 0; i < b.N; i++ {
+			var result strings.Builder
+			for _, d := range data {
+				result.WriteString(fmt.Sprintf("%v,", d))
+			}
+		}
+	})
+	b.Run("cbytes", func(b *testing.B) {
+		b.SetBytes(int64(len(data)))
+		for i := 0; i < b.N; i++ {
+			String(data)
+		}
+	})
+}
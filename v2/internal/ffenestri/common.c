@@ -18,6 +18,13 @@ char* concat(const char *string1, const char *string2)
     return result;
 }
 
+char* copyString(const char *string) {
+    const size_t length = strlen(string);
+    char *result = malloc(length + 1);
+    memcpy(result, string, length + 1);
+    return result;
+}
+
 // 10k is more than enough for a log message
 #define MAXMESSAGE 1024*10
 char abortbuffer[MAXMESSAGE];
@@ -11,16 +11,18 @@
 #include "hashmap.h"
 #include "vec.h"
 #include "json.h"
+#include "native/stringbuilder.h"
 
 #define STREQ(a,b) strcmp(a, b) == 0
 #define STREMPTY(string) strlen(string) == 0
-#define STRCOPY(a) concat(a, "")
+#define STRCOPY(a) copyString(a)
 #define STR_HAS_CHARS(input) input != NULL && strlen(input) > 0
 #define MEMFREE(input) free((void*)input); input = NULL;
 #define FREE_AND_SET(variable, value) if( variable != NULL ) { MEMFREE(variable); } variable = value
 
 // Credit: https://stackoverflow.com/a/8465083
 char* concat(const char *string1, const char *string2);
+char* copyString(const char *string);
 void ABORT(const char *message, ...);
 int freeHashmapItem(void *const context, struct hashmap_element_s *const e);
 const char* getJSONString(JsonNode *item, const char* key);
@@ -2,6 +2,7 @@
 #ifdef FFENESTRI_DARWIN
 
 #include "ffenestri_darwin.h"
+#include "native/logger.h"
 #include "menu_darwin.h"
 #include "contextmenus_darwin.h"
 #include "traymenustore_darwin.h"
@@ -19,7 +20,10 @@ extern const unsigned char *defaultDialogIcons[];
 int debug;
 
 // A cache for all our dialog icons
-struct hashmap_s dialogIconCache;
+IconCache dialogIconCache;
+
+// A cache for images set from base64 data, shared by trays and menus
+IconCache imageCache;
 
 // Dispatch Method
 typedef void (^dispatchMethod)(void);
@@ -159,42 +163,24 @@ struct Application {
 
 };
 
-// Debug works like sprintf but mutes if the global debug flag is true
-// Credit: https://stackoverflow.com/a/20639708
-
-#define MAXMESSAGE 1024*10
-char logbuffer[MAXMESSAGE];
-
-void Debug(struct Application *app, const char *message, ... ) {
-	if ( debug ) {
-		const char *temp = concat("LTFfenestri (C) | ", message);
-		va_list args;
-		va_start(args, message);
-		vsnprintf(logbuffer, MAXMESSAGE, temp, args);
-		app->sendMessageToBackend(&logbuffer[0]);
-		MEMFREE(temp);
-		va_end(args);
+// Debug, Error and Fatal work like printf. The app parameter is unused and
+// the arguments are only evaluated when the log level is enabled.
+#define Debug(app, ...) LOG_TRACE(__VA_ARGS__)
+#define Error(app, ...) LOG_ERROR(__VA_ARGS__)
+#define Fatal(app, ...) LOG_FATAL(__VA_ARGS__)
+
+// writeLog is the log sink. It is called on the logging thread and forwards
+// the message to the Go logger.
+static void writeLog(int level, const char *message) {
+	const char *prefix = "LT";
+	if( level == LOG_LEVEL_ERROR ) {
+		prefix = "LE";
+	} else if( level == LOG_LEVEL_FATAL ) {
+		prefix = "LF";
 	}
-}
-
-void Error(struct Application *app, const char *message, ... ) {
-    const char *temp = concat("LEFfenestri (C) | ", message);
-    va_list args;
-    va_start(args, message);
-    vsnprintf(logbuffer, MAXMESSAGE, temp, args);
-    app->sendMessageToBackend(&logbuffer[0]);
-    MEMFREE(temp);
-    va_end(args);
-}
-
-void Fatal(struct Application *app, const char *message, ... ) {
-  const char *temp = concat("LFFfenestri (C) | ", message);
-  va_list args;
-  va_start(args, message);
-  vsnprintf(logbuffer, MAXMESSAGE, temp, args);
-  app->sendMessageToBackend(&logbuffer[0]);
-  MEMFREE(temp);
-  va_end(args);
+	char logMessage[LOG_MESSAGE_SIZE + 32];
+	snprintf(logMessage, sizeof(logMessage), "%sFfenestri (C) | %s", prefix, message);
+	messageFromWindowCallback(logMessage);
 }
 
 // Requires NSString input EG lookupStringConstant(str("NSFontAttributeName"))
@@ -471,14 +457,7 @@ void destroyContextMenus(struct Application *app) {
 
 void freeDialogIconCache(struct Application *app) {
 	// Release the dialog cache images
-    if( hashmap_num_entries(&dialogIconCache) > 0 ) {
-        if (0!=hashmap_iterate_pairs(&dialogIconCache, releaseNSObject, NULL)) {
-            Fatal(app, "failed to release hashmap entries!");
-        }
-    }
-
-    //Free radio groups hashmap
-    hashmap_destroy(&dialogIconCache);
+	DestroyIconCache(&dialogIconCache);
 }
 
 void DestroyApplication(struct Application *app) {
@@ -523,6 +502,7 @@ void DestroyApplication(struct Application *app) {
 
     // Unload the tray Icons
     UnloadTrayIcons();
+    DestroyIconCache(&imageCache);
 
 	// Remove script handlers
 	msg_id(app->manager, s("removeScriptMessageHandlerForName:"), str("contextMenu"));
@@ -540,6 +520,9 @@ void DestroyApplication(struct Application *app) {
 
 
 	Debug(app, "Finished Destroying Application");
+
+	// Write out any pending log messages
+	LogStop();
 }
 
 // SetTitle sets the main window title to the given string
@@ -756,14 +739,14 @@ void MessageDialog(struct Application *app, char *callbackID, char *type, char *
 	    char *themeIcon = concat(dialogIcon, (isDarkMode(app) ? "-dark" : "-light") );
 	    if( isRetina(app) ) {
 	        char *dialogIcon2x = concat(themeIcon, "2x");
-	        dialogImage = hashmap_get(&dialogIconCache, dialogIcon2x, strlen(dialogIcon2x));
+	        dialogImage = IconCacheGetNamed(&dialogIconCache, dialogIcon2x);
 //	        if (dialogImage != NULL ) printf("Using %s\n", dialogIcon2x);
 	        MEMFREE(dialogIcon2x);
 
 			// Now look for non-themed icon `name2x`
 			if ( dialogImage == NULL ) {
 	            dialogIcon2x = concat(dialogIcon, "2x");
-	            dialogImage = hashmap_get(&dialogIconCache, dialogIcon2x, strlen(dialogIcon2x));
+	            dialogImage = IconCacheGetNamed(&dialogIconCache, dialogIcon2x);
 //		        if (dialogImage != NULL ) printf("Using %s\n", dialogIcon2x);
 	            MEMFREE(dialogIcon2x);
             }
@@ -771,7 +754,7 @@ void MessageDialog(struct Application *app, char *callbackID, char *type, char *
 
 	    // If we don't have a retina icon, try the 1x name-theme icon
 	    if( dialogImage == NULL ) {
-	        dialogImage = hashmap_get(&dialogIconCache, themeIcon, strlen(themeIcon));
+	        dialogImage = IconCacheGetNamed(&dialogIconCache, themeIcon);
 //            if (dialogImage != NULL ) printf("Using %s\n", themeIcon);
 	    }
 
@@ -780,7 +763,7 @@ void MessageDialog(struct Application *app, char *callbackID, char *type, char *
 
 	    // Finally try the name itself
 	    if( dialogImage == NULL ) {
-	        dialogImage = hashmap_get(&dialogIconCache, dialogIcon, strlen(dialogIcon));
+	        dialogImage = IconCacheGetNamed(&dialogIconCache, dialogIcon);
 //            if (dialogImage != NULL ) printf("Using %s\n", dialogIcon);
 	    }
 
@@ -806,16 +789,12 @@ void MessageDialog(struct Application *app, char *callbackID, char *type, char *
 
 	    if ( STR_HAS_CHARS(callbackID) ) {
             // Construct callback message. Format "DM<callbackID>|<selected button index>"
-            const char *callback = concat("DM", callbackID);
-            const char *header = concat(callback, "|");
-            const char *responseMessage = concat(header, buttonPressed);
+            const char *responseMessage = createCallbackMessage("DM", callbackID, buttonPressed);
 
             // Send message to backend
             app->sendMessageToBackend(responseMessage);
 
             // Free memory
-            MEMFREE(header);
-            MEMFREE(callback);
             MEMFREE(responseMessage);
         }
     );
@@ -895,16 +874,13 @@ void OpenDialog(struct Application *app, char *callbackID, char *title, char *fi
 			json_delete(response);
 
 			// Construct callback message. Format "D<callbackID>|<json array of strings>"
-			const char *callback = concat("DO", callbackID);
-			const char *header = concat(callback, "|");
-			const char *responseMessage = concat(header, encoded);
+			const char *responseMessage = createCallbackMessage("DO", callbackID, encoded);
+			MEMFREE(encoded);
 
 			// Send message to backend
 			app->sendMessageToBackend(responseMessage);
 
 			// Free memory
-			MEMFREE(header);
-			MEMFREE(callback);
 			MEMFREE(responseMessage);
 		});
 
@@ -967,16 +943,12 @@ void SaveDialog(struct Application *app, char *callbackID, char *title, char *fi
 			}
 
 			// Construct callback message. Format "DS<callbackID>|<json array of strings>"
-			const char *callback = concat("DS", callbackID);
-			const char *header = concat(callback, "|");
-			const char *responseMessage = concat(header, filename);
+			const char *responseMessage = createCallbackMessage("DS", callbackID, filename);
 
 			// Send message to backend
 			app->sendMessageToBackend(responseMessage);
 
 			// Free memory
-			MEMFREE(header);
-			MEMFREE(callback);
 			MEMFREE(responseMessage);
 		});
 
@@ -1056,6 +1028,7 @@ void SetMaxWindowSize(struct Application *app, int maxWidth, int maxHeight)
 
 void SetDebug(void *applicationPointer, int flag) {
 	debug = flag;
+	SetLogLevel(flag ? LOG_LEVEL_TRACE : LOG_LEVEL_ERROR);
 }
 
 
@@ -1113,10 +1086,14 @@ void UpdateTrayMenuLabel(struct Application* app, const char* JSON) {
 
 
 void SetBindings(struct Application *app, const char *bindings) {
-	const char* temp = concat("window.wailsbindings = \"", bindings);
-	const char* jscall = concat(temp, "\";");
-	MEMFREE(temp);
-	app->bindings = jscall;
+	const char *prefix = "window.wailsbindings = \"";
+	const char *suffix = "\";";
+	StringBuilder jscall;
+	StringBuilderInit(&jscall, strlen(prefix) + strlen(bindings) + strlen(suffix));
+	StringBuilderAppend(&jscall, prefix);
+	StringBuilderAppend(&jscall, bindings);
+	StringBuilderAppend(&jscall, suffix);
+	app->bindings = StringBuilderTake(&jscall);
 }
 
 void makeWindowBackgroundTranslucent(struct Application *app) {
@@ -1179,15 +1156,11 @@ void DarkModeEnabled(struct Application *app, const char *callbackID) {
 		const char *result = isDarkMode(app) ? "T" : "F";
 
 		// Construct callback message. Format "SD<callbackID>|<json array of strings>"
-		const char *callback = concat("SD", callbackID);
-		const char *header = concat(callback, "|");
-		const char *responseMessage = concat(header, result);
+		const char *responseMessage = createCallbackMessage("SD", callbackID, result);
 		// Send message to backend
 		app->sendMessageToBackend(responseMessage);
 
 		// Free memory
-		MEMFREE(header);
-		MEMFREE(callback);
 		MEMFREE(responseMessage);
 	);
 }
@@ -1431,7 +1404,7 @@ void SetApplicationMenu(struct Application *app, const char *menuAsJSON) {
     );
 }
 
-void processDialogIcons(struct hashmap_s *hashmap, const unsigned char *dialogIcons[]) {
+void processDialogIcons(IconCache *cache, const unsigned char *dialogIcons[]) {
 
 	unsigned int count = 0;
     while( 1 ) {
@@ -1449,24 +1422,16 @@ void processDialogIcons(struct hashmap_s *hashmap, const unsigned char *dialogIc
         }
         int length = atoi((const char *)lengthAsString);
 
-        // Create the icon and add to the hashmap
-        id imageData = ((id(*)(id, SEL, const unsigned char *, int))objc_msgSend)(c("NSData"), s("dataWithBytes:length:"), data, length);
-        id dialogImage = ALLOC("NSImage");
-        msg_reg(dialogImage, s("autorelease"));
-        msg_id(dialogImage, s("initWithData:"), imageData);
-        hashmap_put(hashmap, (const char *)name, strlen((const char *)name), dialogImage);
+        // Add the icon to the cache. It is decoded when first used.
+        IconCacheAddNamed(cache, (const char *)name, data, length, 0);
     }
 
 }
 
 void processUserDialogIcons(struct Application *app) {
 
-	// Allocate the Dialog icon hashmap
-	if( 0 != hashmap_create((const unsigned)4, &dialogIconCache)) {
-	   // Couldn't allocate map
-	   Fatal(app, "Not enough memory to allocate dialogIconCache!");
-	   return;
-	}
+	// Allocate the Dialog icon cache
+	InitIconCache(&dialogIconCache, decodeImage, releaseImage);
 
 	processDialogIcons(&dialogIconCache, defaultDialogIcons);
 	processDialogIcons(&dialogIconCache, userDialogIcons);
@@ -1718,30 +1683,51 @@ void Quit(struct Application *app) {
     msg_id(app->application, s("stop:"), NULL);
 }
 
-id createImageFromBase64Data(const char *data, bool isTemplateImage) {
-    id nsdata = ALLOC("NSData");
-    id imageData = ((id(*)(id, SEL, id, int))objc_msgSend)(nsdata, s("initWithBase64EncodedString:options:"), str(data), 0);
+// decodeImage is the IconCache decoder for NSImages. The image is returned
+// retained and released by releaseImage.
+void* decodeImage(const unsigned char *data, size_t length, int flags) {
+    id nsdata = NULL;
+    id imageData;
+    if( flags & ICONCACHE_BASE64 ) {
+        nsdata = ALLOC("NSData");
+        imageData = ((id(*)(id, SEL, id, int))objc_msgSend)(nsdata, s("initWithBase64EncodedString:options:"), str((const char *)data), 0);
 
-    // If it's not valid base64 data, use the broken image
-    if ( imageData == NULL ) {
-        imageData = ((id(*)(id, SEL, id, int))objc_msgSend)(nsdata, s("initWithBase64EncodedString:options:"), str(BrokenImage), 0);
+        // If it's not valid base64 data, use the broken image
+        if ( imageData == NULL ) {
+            imageData = ((id(*)(id, SEL, id, int))objc_msgSend)(nsdata, s("initWithBase64EncodedString:options:"), str(BrokenImage), 0);
+        }
+    } else {
+        imageData = ((id(*)(id, SEL, const unsigned char *, int))objc_msgSend)(c("NSData"), s("dataWithBytes:length:"), data, (int)length);
     }
     id result = ALLOC("NSImage");
-    msg_reg(result, s("autorelease"));
     msg_id(result, s("initWithData:"), imageData);
-    msg_reg(nsdata, s("release"));
-    msg_reg(imageData, s("release"));
+    if( nsdata != NULL ) {
+        msg_reg(nsdata, s("release"));
+        msg_reg(imageData, s("release"));
+    }
 
-    if( isTemplateImage ) {
+    if( flags & ICONCACHE_TEMPLATE ) {
         msg_bool(result, s("setTemplate:"), YES);
     }
 
     return result;
 }
 
+void releaseImage(void *image) {
+    msg_reg((id)image, s("release"));
+}
+
+// createImageFromBase64Data returns the image for the given base64 data. Images
+// are cached by content so setting the same image again doesn't decode it.
+id createImageFromBase64Data(const char *data, bool isTemplateImage) {
+    int flags = ICONCACHE_BASE64 | (isTemplateImage ? ICONCACHE_TEMPLATE : 0);
+    return (id)IconCacheGet(&imageCache, (const unsigned char *)data, strlen(data), flags);
+}
+
 void* NewApplication(const char *title, int width, int height, int resizable, int devtools, int fullscreen, int startHidden, int logLevel, int hideWindowOnClose) {
 
-    // Load the tray icons
+    // Setup the image caches
+    InitIconCache(&imageCache, decodeImage, releaseImage);
     LoadTrayIcons();
 
 	// Setup main application struct
@@ -1798,6 +1784,9 @@ void* NewApplication(const char *title, int width, int height, int resizable, in
 
 	result->sendMessageToBackend = (ffenestriCallback) messageFromWindowCallback;
 
+	// Start the logging thread
+	LogStart(writeLog);
+
 	result->shuttingDown = false;
 
 	result->activationPolicy = NSApplicationActivationPolicyRegular;
@@ -9,6 +9,7 @@
 #include <CoreFoundation/CoreFoundation.h>
 #include "json.h"
 #include "hashmap.h"
+#include "native/iconcache.h"
 #include "stdlib.h"
 
 typedef struct {
@@ -150,5 +151,7 @@ void* lookupStringConstant(id constantName);
 void HasURLHandlers(struct Application* app);
 
 id createImageFromBase64Data(const char *data, bool isTemplateImage);
+void* decodeImage(const unsigned char *data, size_t length, int flags);
+void releaseImage(void *image);
 
 #endif
\ No newline at end of file
@@ -3,6 +3,9 @@
 #define __FFENESTRI_LINUX_H__
 
 #include "common.h"
+#include "native/logger.h"
+#include "native/trace.h"
+#include "native/commandqueue.h"
 #include "gtk/gtk.h"
 #include "webkit2/webkit2.h"
 #include <time.h>
@@ -22,24 +25,16 @@ extern const unsigned char runtime;
 #define MIDDLE_MOUSE_BUTTON 2
 #define SECONDARY_MOUSE_BUTTON 3
 
-// MAIN DEBUG FLAG
-int debug;
+// Debug works like printf. It compiles to a level check when tracing is
+// off and the arguments are only evaluated when it is on.
+#define Debug(...) LOG_TRACE(__VA_ARGS__)
 
-// Debug works like sprintf but mutes if the global debug flag is true
-// Credit: https://stackoverflow.com/a/20639708
-void Debug(char *message, ...)
+static const char *logLevelNames[] = {"", "TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "FATAL"};
+
+// writeLog is the log sink. It is called on the logging thread.
+static void writeLog(int level, const char *message)
 {
-    if (debug)
-    {
-        char *temp = concat("TRACE | Ffenestri (C) | ", message);
-        message = concat(temp, "\n");
-        free(temp);
-        va_list args;
-        va_start(args, message);
-        vprintf(message, args);
-        free(message);
-        va_end(args);
-    }
+    printf("%s | Ffenestri (C) | %s\n", logLevelNames[level], message);
 }
 
 extern void messageFromWindowCallback(const char *);
@@ -90,8 +85,25 @@ struct Application
 
     // Lock - used for sync operations (Should we be using g_mutex?)
     int lock;
+
+    // Calls waiting to run on the main thread
+    CommandQueue *commands;
+
+    // Held for reading while pushing to commands and for writing while
+    // releasing it, so a late dispatch never uses a released queue
+    pthread_rwlock_t commandsLock;
 };
 
+gboolean drainCommands(gpointer data);
+
+// scheduleDrain is called when the first command is added to an empty
+// command queue. It schedules a single idle call to run all queued commands.
+// The idle source has the queue as its data so DestroyApplication can remove it.
+static void scheduleDrain(CommandQueue *queue)
+{
+    g_idle_add(drainCommands, queue);
+}
+
 void *NewApplication(const char *title, int width, int height, int resizable, int devtools, int fullscreen, int startHidden)
 {
     // Setup main application struct
@@ -114,6 +126,16 @@ void *NewApplication(const char *title, int width, int height, int resizable, in
 
     result->sendMessageToBackend = (ffenestriCallback)messageFromWindowCallback;
 
+    // Start the logging thread
+    LogStart(writeLog);
+
+    // Enable tracing if requested
+    TraceInit();
+
+    // Setup the main thread command queue
+    result->commands = NewCommandQueue(scheduleDrain, result);
+    pthread_rwlock_init(&result->commandsLock, NULL);
+
     // Create a unique ID based on the current unix timestamp
     char temp[11];
     sprintf(&temp[0], "%d", (int)time(NULL));
@@ -165,6 +187,18 @@ void DestroyApplication(struct Application *app)
     }
     g_signal_handler_disconnect(app->webView, app->signalLoadChanged);
 
+    // The main loop has stopped, so commands still queued will never run.
+    // Remove the idle call that would drain them and release the queue.
+    // Commands dispatched from now on are dropped.
+    pthread_rwlock_wrlock(&app->commandsLock);
+    if (app->commands != NULL)
+    {
+        g_idle_remove_by_data(app->commands);
+        DeleteCommandQueue(app->commands);
+        app->commands = NULL;
+    }
+    pthread_rwlock_unlock(&app->commandsLock);
+
     // Release the main GTK Application
     if (app->application != NULL)
     {
@@ -176,6 +210,15 @@ void DestroyApplication(struct Application *app)
         Debug("Almost a double free for app->application");
     }
     Debug("Finished Destroying Application");
+
+    // Write out the trace if we have one
+    if (traceEnabled)
+    {
+        TraceDump();
+    }
+
+    // Write out any pending log messages
+    LogStop();
 }
 
 // Quit will stop the gtk application and free up all the memory
@@ -332,6 +375,7 @@ void syncCallback(GObject *source_object,
 
 void syncEval(struct Application *app, const gchar *script)
 {
+    TRACE_BEGIN("syncEval");
 
     WebKitWebView *webView = (WebKitWebView *)(app->webView);
 
@@ -352,6 +396,8 @@ void syncEval(struct Application *app, const gchar *script)
     {
         g_main_context_iteration(0, true);
     }
+
+    TRACE_END("syncEval");
 }
 
 void asyncEval(WebKitWebView *webView, const gchar *script)
@@ -362,126 +408,137 @@ void asyncEval(WebKitWebView *webView, const gchar *script)
         NULL, NULL, NULL);
 }
 
-typedef void (*dispatchMethod)(struct Application *app, void *);
+typedef void (*dispatchMethod)(struct Application *app, CommandArgs *args);
 
-struct dispatchData
+// drainCommands runs all queued commands on the main thread
+gboolean drainCommands(gpointer data)
 {
-    struct Application *app;
-    dispatchMethod method;
-    void *args;
-};
+    TRACE_BEGIN("drainCommands");
+    CommandQueueDrain((CommandQueue *)data);
+    TRACE_END("drainCommands");
+    return FALSE;
+}
 
-gboolean executeMethod(gpointer data)
+// dispatch queues the given method to be called on the main thread. Once the
+// application has been destroyed, the method is dropped and false returned.
+static bool dispatch(struct Application *app, dispatchMethod method, CommandArgs args)
 {
-    struct dispatchData *d = (struct dispatchData *)data;
-    (d->method)(d->app, d->args);
-    g_free(d);
-    return FALSE;
+    pthread_rwlock_rdlock(&app->commandsLock);
+    bool queued = app->commands != NULL;
+    if (queued)
+    {
+        CommandQueuePush(app->commands, (commandMethod)method, app, args);
+    }
+    pthread_rwlock_unlock(&app->commandsLock);
+    return queued;
 }
 
-void ExecJS(struct Application *app, char *js)
+// dispatchNoArgs queues the given method to be called on the main thread
+static void dispatchNoArgs(struct Application *app, dispatchMethod method)
 {
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)syncEval;
-    data->args = js;
-    data->app = app;
+    CommandArgs args = {0};
+    dispatch(app, method, args);
+}
 
-    gdk_threads_add_idle(executeMethod, data);
+void execJSInternal(struct Application *app, CommandArgs *args)
+{
+    syncEval(app, (const gchar *)args->pointer);
+}
+
+void ExecJS(struct Application *app, char *js)
+{
+    CommandArgs args;
+    args.pointer = js;
+    dispatch(app, execJSInternal, args);
 }
 
 typedef char *(*dialogMethod)(struct Application *app, void *);
 
 struct dialogCall
 {
-    struct Application *app;
     dialogMethod method;
     void *args;
-    void *filter;
     char *result;
-    int done;
+    volatile int done;
 };
 
-gboolean executeMethodWithReturn(gpointer data)
+void executeMethodWithReturn(struct Application *app, CommandArgs *args)
 {
-    struct dialogCall *d = (struct dialogCall *)data;
+    struct dialogCall *d = (struct dialogCall *)args->pointer;
 
-    d->result = (d->method)(d->app, d->args);
+    TRACE_BEGIN("dialog");
+    d->result = (d->method)(app, d->args);
+    TRACE_END("dialog");
     d->done = 1;
-    return FALSE;
 }
 
-char *OpenFileDialog(struct Application *app, char *title, char *filter)
+// runDialog runs the given dialog method on the main thread and waits for the result
+static char *runDialog(struct Application *app, dialogMethod method, char *title, char *filter)
 {
-    struct dialogCall *data = (struct dialogCall *)g_new(struct dialogCall, 1);
-    data->result = NULL;
-    data->done = 0;
-    data->method = (dialogMethod)openFileDialogInternal;
-    const char* dialogArgs[]={ title, filter };
-    data->args = dialogArgs;
-    data->app = app;
+    const char *dialogArgs[] = {title, filter};
+    struct dialogCall call;
+    call.method = method;
+    call.args = dialogArgs;
+    call.result = NULL;
+    call.done = 0;
 
-    gdk_threads_add_idle(executeMethodWithReturn, data);
+    CommandArgs args;
+    args.pointer = &call;
+    if (!dispatch(app, executeMethodWithReturn, args))
+    {
+        return NULL;
+    }
 
-    while (data->done == 0)
+    while (call.done == 0)
     {
         usleep(100000);
     }
-    g_free(data);
-    return data->result;
+    return call.result;
 }
 
-char *SaveFileDialog(struct Application *app, char *title, char *filter)
+char *OpenFileDialog(struct Application *app, char *title, char *filter)
 {
-    struct dialogCall *data = (struct dialogCall *)g_new(struct dialogCall, 1);
-    data->result = NULL;
-    data->done = 0;
-    data->method = (dialogMethod)saveFileDialogInternal;
-    const char* dialogArgs[]={ title, filter };
-    data->args = dialogArgs;
-    data->app = app;
-
-    gdk_threads_add_idle(executeMethodWithReturn, data);
+    TRACE_BEGIN("OpenFileDialog");
+    char *result = runDialog(app, (dialogMethod)openFileDialogInternal, title, filter);
+    TRACE_END("OpenFileDialog");
+    return result;
+}
 
-    while (data->done == 0)
-    {
-        usleep(100000);
-    }
+char *SaveFileDialog(struct Application *app, char *title, char *filter)
+{
+    TRACE_BEGIN("SaveFileDialog");
+    char *result = runDialog(app, (dialogMethod)saveFileDialogInternal, title, filter);
+    TRACE_END("SaveFileDialog");
     Debug("Dialog done");
-    Debug("Result = %s\n", data->result);
-
-    g_free(data);
-    // Fingers crossed this wasn't freed by g_free above
-    return data->result;
+    Debug("Result = %s\n", result);
+    return result;
 }
 
 char *OpenDirectoryDialog(struct Application *app, char *title, char *filter)
 {
-    struct dialogCall *data = (struct dialogCall *)g_new(struct dialogCall, 1);
-    data->result = NULL;
-    data->done = 0;
-    data->method = (dialogMethod)openDirectoryDialogInternal;
-    const char* dialogArgs[]={ title, filter };
-    data->args = dialogArgs;
-    data->app = app;
-
-    gdk_threads_add_idle(executeMethodWithReturn, data);
-
-    while (data->done == 0)
-    {
-        usleep(100000);
-    }
+    TRACE_BEGIN("OpenDirectoryDialog");
+    char *result = runDialog(app, (dialogMethod)openDirectoryDialogInternal, title, filter);
+    TRACE_END("OpenDirectoryDialog");
     Debug("Directory Dialog done");
-    Debug("Result = %s\n", data->result);
-    g_free(data);
-    // Fingers crossed this wasn't freed by g_free above
-    return data->result;
+    Debug("Result = %s\n", result);
+    return result;
 }
 
-// Sets the icon to the XPM stored in icon
+// The application icons, wrapped around the RGBA data in icon.h on first use
+static GList *appIcons = NULL;
+
+// Sets the window icons to the RGBA icons stored in icon.h. The pixbufs
+// reference the static data directly so are created once and never freed.
 void setIcon(struct Application *app)
 {
-    GdkPixbuf *appIcon = gdk_pixbuf_new_from_xpm_data((const char **)icon);
-    gtk_window_set_icon(app->mainWindow, appIcon);
+    if( appIcons == NULL ) {
+        for( int index = iconCount - 1; index >= 0; index-- ) {
+            int size = iconSizes[index];
+            GdkPixbuf *appIcon = gdk_pixbuf_new_from_data(iconData[index], GDK_COLORSPACE_RGB, TRUE, 8, size, size, size * 4, NULL, NULL);
+            appIcons = g_list_prepend(appIcons, appIcon);
+        }
+    }
+    gtk_window_set_icon_list(app->mainWindow, appIcons);
 }
 
 static void load_finished_cb(WebKitWebView *webView,
@@ -509,21 +566,29 @@ static void load_finished_cb(WebKitWebView *webView,
     case WEBKIT_LOAD_FINISHED:
         /* Load finished, we can now stop the spinner */
         // printf("Finished loading: %s\n", webkit_web_view_get_uri(web_view));
+        TRACE_BEGIN("load_finished_cb");
 
         // Bindings
         Debug("Binding Methods");
+        TRACE_BEGIN("load_finished_cb.bindings");
         syncEval(app, app->bindings);
+        TRACE_END("load_finished_cb.bindings");
 
         // Setup IPC commands
         Debug("Setting up IPC methods");
+        TRACE_BEGIN("load_finished_cb.ipc");
         const char *invoke = "window.wailsInvoke=function(message){window.webkit.messageHandlers.external.postMessage(message);};window.wailsDrag=function(message){window.webkit.messageHandlers.windowDrag.postMessage(message);};window.wailsContextMenuMessage=function(message){window.webkit.messageHandlers.contextMenu.postMessage(message);};";
         syncEval(app, invoke);
+        TRACE_END("load_finished_cb.ipc");
 
         // Runtime
         Debug("Setting up Wails runtime");
+        TRACE_BEGIN("load_finished_cb.runtime");
         syncEval(app, &runtime);
+        TRACE_END("load_finished_cb.runtime");
 
         // Loop over assets
+        TRACE_BEGIN("load_finished_cb.assets");
         int index = 1;
         while (1)
         {
@@ -540,9 +605,14 @@ static void load_finished_cb(WebKitWebView *webView,
             syncEval(app, asset);
             index++;
         };
+        TRACE_END("load_finished_cb.assets");
 
         // Set the icon
+        TRACE_BEGIN("load_finished_cb.icon");
         setIcon(app);
+        TRACE_END("load_finished_cb.icon");
+
+        TRACE_BEGIN("load_finished_cb.window");
 
         // Setup fullscreen
         if (app->fullscreen)
@@ -577,6 +647,8 @@ static void load_finished_cb(WebKitWebView *webView,
             gtk_widget_show_all(GTK_WIDGET(app->mainWindow));
             gtk_widget_grab_focus(app->webView);
         }
+        TRACE_END("load_finished_cb.window");
+        TRACE_END("load_finished_cb");
         break;
     }
 }
@@ -673,7 +745,7 @@ static void sendMessageToBackend(WebKitUserContentManager *contentManager,
 
 void SetDebug(struct Application *app, int flag)
 {
-    debug = flag;
+    SetLogLevel(flag ? LOG_LEVEL_TRACE : LOG_LEVEL_ERROR);
 }
 
 // getCurrentMonitorGeometry gets the geometry of the monitor
@@ -695,67 +767,41 @@ GdkRectangle getCurrentMonitorGeometry(GtkWindow *window) {
  * Window Position *
  *******************/
 
-// Position holds an x/y corrdinate
-struct Position {
-    int x;
-    int y;
-};
-
 // Internal call for setting the position of the window.
-void setPositionInternal(struct Application *app, struct Position *pos) {
+void setPositionInternal(struct Application *app, CommandArgs *args) {
 
     // Get the monitor geometry
     GdkRectangle m = getCurrentMonitorGeometry(app->mainWindow);
 
     // Move the window relative to the monitor
-    gtk_window_move(app->mainWindow, m.x + pos->x, m.y + pos->y);
-    
-    // Free memory
-    free(pos);
+    gtk_window_move(app->mainWindow, m.x + args->position.x, m.y + args->position.y);
 }
 
 // SetPosition sets the position of the window to the given x/y 
 // coordinates. The x/y values are relative to the monitor 
 // the window is mostly on.
 void SetPosition(struct Application *app, int x, int y) {
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)setPositionInternal;
-    struct Position *pos = malloc(sizeof(struct Position));
-    pos->x = x;
-    pos->y = y;
-    data->args = pos;
-    data->app = app;
-
-    gdk_threads_add_idle(executeMethod, data);  
+    CommandArgs args;
+    args.position.x = x;
+    args.position.y = y;
+    dispatch(app, setPositionInternal, args);
 }
 
 /***************
  * Window Size *
  ***************/
 
-// Size holds a width/height
-struct Size {
-    int width;
-    int height;
-};
-
 // Internal call for setting the size of the window.
-void setSizeInternal(struct Application *app, struct Size *size) {
-    gtk_window_resize(app->mainWindow, size->width, size->height);
-    free(size);
+void setSizeInternal(struct Application *app, CommandArgs *args) {
+    gtk_window_resize(app->mainWindow, args->size.width, args->size.height);
 }
 
 // SetSize sets the size of the window to the given width/height
 void SetSize(struct Application *app, int width, int height) {
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)setSizeInternal;
-    struct Size *size = malloc(sizeof(struct Size));
-    size->width = width;
-    size->height = height;
-    data->args = size;
-    data->app = app;
-
-    gdk_threads_add_idle(executeMethod, data);  
+    CommandArgs args;
+    args.size.width = width;
+    args.size.height = height;
+    dispatch(app, setSizeInternal, args);
 }
 
 
@@ -777,12 +823,7 @@ void centerInternal(struct Application *app)
 void Center(struct Application *app) {
 
     // Setup a call to centerInternal on the main thread
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)centerInternal;
-    data->app = app;
-
-    // Add call to main thread
-    gdk_threads_add_idle(executeMethod, data);  
+    dispatchNoArgs(app, (dispatchMethod)centerInternal);
 }
 
 // hideInternal hides the main window
@@ -794,12 +835,7 @@ void hideInternal(struct Application *app) {
 void Hide(struct Application *app) {
 
     // Setup a call to hideInternal on the main thread
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)hideInternal;
-    data->app = app;
-
-    // Add call to main thread
-    gdk_threads_add_idle(executeMethod, data);  
+    dispatchNoArgs(app, (dispatchMethod)hideInternal);
 }
 
 // showInternal shows the main window 
@@ -810,11 +846,7 @@ void showInternal(struct Application *app) {
 
 // Show places the showInternal method onto the main thread for execution
 void Show(struct Application *app) {
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)showInternal;
-    data->app = app;
-
-    gdk_threads_add_idle(executeMethod, data);  
+    dispatchNoArgs(app, (dispatchMethod)showInternal);
 }
 
 
@@ -827,12 +859,7 @@ void maximiseInternal(struct Application *app) {
 void Maximise(struct Application *app) {
 
     // Setup a call to maximiseInternal on the main thread
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)maximiseInternal;
-    data->app = app;
-
-    // Add call to main thread
-    gdk_threads_add_idle(executeMethod, data);  
+    dispatchNoArgs(app, (dispatchMethod)maximiseInternal);
 }
 
 // unmaximiseInternal unmaximises the main window
@@ -844,12 +871,7 @@ void unmaximiseInternal(struct Application *app) {
 void Unmaximise(struct Application *app) {
 
     // Setup a call to unmaximiseInternal on the main thread
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)unmaximiseInternal;
-    data->app = app;
-
-    // Add call to main thread
-    gdk_threads_add_idle(executeMethod, data);  
+    dispatchNoArgs(app, (dispatchMethod)unmaximiseInternal);
 }
 
 
@@ -877,12 +899,7 @@ void minimiseInternal(struct Application *app) {
 void Minimise(struct Application *app) {
 
     // Setup a call to minimiseInternal on the main thread
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)minimiseInternal;
-    data->app = app;
-
-    // Add call to main thread
-    gdk_threads_add_idle(executeMethod, data);  
+    dispatchNoArgs(app, (dispatchMethod)minimiseInternal);
 }
 
 // unminimiseInternal unminimises the main window
@@ -894,21 +911,20 @@ void unminimiseInternal(struct Application *app) {
 void Unminimise(struct Application *app) {
 
     // Setup a call to unminimiseInternal on the main thread
-    struct dispatchData *data = (struct dispatchData *)g_new(struct dispatchData, 1);
-    data->method = (dispatchMethod)unminimiseInternal;
-    data->app = app;
-
-    // Add call to main thread
-    gdk_threads_add_idle(executeMethod, data);  
+    dispatchNoArgs(app, (dispatchMethod)unminimiseInternal);
 }
 
 
 void SetBindings(struct Application *app, const char *bindings)
 {
-    const char *temp = concat("window.wailsbindings = \"", bindings);
-    const char *jscall = concat(temp, "\";");
-    free((void *)temp);
-    app->bindings = jscall;
+    const char *prefix = "window.wailsbindings = \"";
+    const char *suffix = "\";";
+    StringBuilder jscall;
+    StringBuilderInit(&jscall, strlen(prefix) + strlen(bindings) + strlen(suffix));
+    StringBuilderAppend(&jscall, prefix);
+    StringBuilderAppend(&jscall, bindings);
+    StringBuilderAppend(&jscall, suffix);
+    app->bindings = StringBuilderTake(&jscall);
 }
 
 // This is called when the close button on the window is pressed
@@ -0,0 +1,10 @@
+//go:build production && !windows
+// +build production,!windows
+
+package ffenestri
+
+/*
+// Compile out trace, debug and info logging in the native layer
+#cgo CFLAGS: -DFFENESTRI_LOG_MIN_LEVEL=4
+*/
+import "C"
@@ -17,8 +17,8 @@ Menu* NewMenu(JsonNode *menuData) {
     // No title by default
     result->title = "";
 
-    // Initialise menuCallbackDataCache
-    vec_init(&result->callbackDataCache);
+    // Initialise the pool for the menu item data
+    InitMemPool(&result->pool, MEMPOOL_DEFAULT_BLOCK_SIZE);
 
     // Allocate MenuItem Map
     if( 0 != hashmap_create((const unsigned)16, &result->menuItemMap)) {
@@ -51,16 +51,13 @@ Menu* NewApplicationMenu(const char *menuAsJSON) {
 }
 
 MenuItemCallbackData* CreateMenuItemCallbackData(Menu *menu, id menuItem, const char *menuID, enum MenuItemType menuItemType) {
-    MenuItemCallbackData* result = malloc(sizeof(MenuItemCallbackData));
+    MenuItemCallbackData* result = MemPoolAlloc(&menu->pool, sizeof(MenuItemCallbackData));
 
     result->menu = menu;
     result->menuID = menuID;
     result->menuItem = menuItem;
     result->menuItemType = menuItemType;
 
-    // Store reference to this so we can destroy later
-    vec_push(&menu->callbackDataCache, result);
-
     return result;
 }
 
@@ -69,14 +66,7 @@ void DeleteMenu(Menu *menu) {
     // Free menu item hashmap
     hashmap_destroy(&menu->menuItemMap);
 
-    // Free radio group members
-    if( hashmap_num_entries(&menu->radioGroupMap) > 0 ) {
-        if (0 != hashmap_iterate_pairs(&menu->radioGroupMap, freeHashmapItem, NULL)) {
-            ABORT("[DeleteMenu] Failed to release radioGroupMap entries!");
-        }
-    }
-
-    // Free radio groups hashmap
+    // Free radio groups hashmap. The member lists live in the pool.
     hashmap_destroy(&menu->radioGroupMap);
 
     // Free up the processed menu memory
@@ -85,36 +75,15 @@ void DeleteMenu(Menu *menu) {
         menu->processedMenu = NULL;
     }
 
-    // Release the callback data memory + vector
-    int i; MenuItemCallbackData* callbackData;
-    vec_foreach(&menu->callbackDataCache, callbackData, i) {
-      free(callbackData);
-    }
-    vec_deinit(&menu->callbackDataCache);
+    // Release the callback data + radio group memory
+    DestroyMemPool(&menu->pool);
 
     free(menu);
 }
 
 // Creates a JSON message for the given menuItemID and data
 const char* createMenuClickedMessage(const char *menuItemID, const char *data, enum MenuType menuType, const char *parentID) {
-
-    JsonNode *jsonObject = json_mkobject();
-    if (menuItemID == NULL ) {
-        ABORT("Item ID NULL for menu!!\n");
-    }
-    json_append_member(jsonObject, "menuItemID", json_mkstring(menuItemID));
-    json_append_member(jsonObject, "menuType", json_mkstring(MenuTypeAsString[(int)menuType]));
-    if (data != NULL) {
-        json_append_member(jsonObject, "data", json_mkstring(data));
-    }
-    if (parentID != NULL) {
-        json_append_member(jsonObject, "parentID", json_mkstring(parentID));
-    }
-    const char *payload = json_encode(jsonObject);
-    json_delete(jsonObject);
-    const char *result = concat("MC", payload);
-    MEMFREE(payload);
-    return result;
+    return buildMenuClickedMessage(menuItemID, MenuTypeAsString[(int)menuType], data, parentID);
 }
 
 // Callback for text menu items
@@ -942,9 +911,9 @@ void processRadioGroupJSON(Menu *menu, JsonNode *radioGroup) {
     JsonNode *members = json_find_member(radioGroup, "Members");
     JsonNode *member;
 
-    // Allocate array
+    // Allocate array. It is shared by all members of the group.
     size_t arrayLength = sizeof(id)*(groupLength+1);
-    id memberList[arrayLength];
+    id *memberList = MemPoolAlloc(&menu->pool, arrayLength);
 
     // Build the radio group items
     int count=0;
@@ -960,11 +929,8 @@ void processRadioGroupJSON(Menu *menu, JsonNode *radioGroup) {
 
     // Store the members
     json_foreach(member, members) {
-        // Copy the memberList
-        char *newMemberList = (char *)malloc(arrayLength);
-        memcpy(newMemberList, memberList, arrayLength);
         // add group to each member of group
-        hashmap_put(&menu->radioGroupMap, member->string_, strlen(member->string_), newMemberList);
+        hashmap_put(&menu->radioGroupMap, member->string_, strlen(member->string_), memberList);
     }
 
 }
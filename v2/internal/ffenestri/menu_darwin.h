@@ -6,6 +6,7 @@
 #define MENU_DARWIN_H
 
 #include "common.h"
+#include "native/mempool.h"
 #include "ffenestri_darwin.h"
 
 enum MenuItemType {Text = 0, Checkbox = 1, Radio = 2};
@@ -43,8 +44,9 @@ typedef struct {
     struct hashmap_s menuItemMap;
     struct hashmap_s radioGroupMap;
 
-    // Vector to keep track of callback data memory
-    vec_void_t callbackDataCache;
+    // Pool for the per-item data of this menu (callback data, radio
+    // group member lists). Released in one go by DeleteMenu.
+    MemPool pool;
 
     // The NSMenu for this menu
     id menu;
@@ -0,0 +1,9 @@
+// +build !windows
+
+// The units in the native package, which are tested there on their own
+#include "native/mempool.c"
+#include "native/stringbuilder.c"
+#include "native/logger.c"
+#include "native/trace.c"
+#include "native/commandqueue.c"
+#include "native/iconcache.c"
@@ -0,0 +1,114 @@
+// +build !windows
+
+#include <stdlib.h>
+#include "native.h"
+#include "commandqueue.h"
+
+CommandQueue* NewCommandQueue(commandQueueWakeup wakeup, void *data) {
+    CommandQueue *result = malloc(sizeof(CommandQueue));
+    if( result == NULL ) {
+        ABORT("[NewCommandQueue] Not enough memory to allocate CommandQueue!");
+    }
+    if( pthread_mutex_init(&result->lock, NULL) != 0 ) {
+        ABORT("[NewCommandQueue] Unable to initialise mutex!");
+    }
+    result->head = NULL;
+    result->tail = NULL;
+    result->freeList = NULL;
+    result->blocks = NULL;
+    result->blockCount = 0;
+    result->wakeupPending = false;
+    result->wakeup = wakeup;
+    result->data = data;
+    result->wakeups = 0;
+    return result;
+}
+
+void DeleteCommandQueue(CommandQueue *queue) {
+    for( int i = 0; i < queue->blockCount; i++ ) {
+        free(queue->blocks[i]);
+    }
+    free(queue->blocks);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue);
+}
+
+// growCommandPool adds a block of records to the free list. Must hold the lock.
+static void growCommandPool(CommandQueue *queue) {
+    Command *block = malloc(sizeof(Command) * COMMANDQUEUE_BLOCK_SIZE);
+    void **blocks = realloc(queue->blocks, sizeof(void*) * (queue->blockCount + 1));
+    if( block == NULL || blocks == NULL ) {
+        ABORT("[CommandQueuePush] Not enough memory to allocate commands!");
+    }
+    blocks[queue->blockCount++] = block;
+    queue->blocks = blocks;
+    for( int i = 0; i < COMMANDQUEUE_BLOCK_SIZE; i++ ) {
+        block[i].next = queue->freeList;
+        queue->freeList = &block[i];
+    }
+}
+
+void CommandQueuePush(CommandQueue *queue, commandMethod method, void *context, CommandArgs args) {
+    pthread_mutex_lock(&queue->lock);
+
+    if( queue->freeList == NULL ) {
+        growCommandPool(queue);
+    }
+    Command *command = queue->freeList;
+    queue->freeList = command->next;
+
+    command->next = NULL;
+    command->method = method;
+    command->context = context;
+    command->args = args;
+
+    if( queue->tail == NULL ) {
+        queue->head = command;
+    } else {
+        queue->tail->next = command;
+    }
+    queue->tail = command;
+
+    bool needsWakeup = !queue->wakeupPending;
+    if( needsWakeup ) {
+        queue->wakeupPending = true;
+        queue->wakeups++;
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    if( needsWakeup ) {
+        queue->wakeup(queue);
+    }
+}
+
+int CommandQueueDrain(CommandQueue *queue) {
+    // Take all the queued commands. Anything pushed from here on
+    // will trigger a new wakeup.
+    pthread_mutex_lock(&queue->lock);
+    Command *commands = queue->head;
+    queue->head = NULL;
+    queue->tail = NULL;
+    queue->wakeupPending = false;
+    pthread_mutex_unlock(&queue->lock);
+
+    if( commands == NULL ) {
+        return 0;
+    }
+
+    int count = 0;
+    Command *last = NULL;
+    for( Command *command = commands; command != NULL; command = command->next ) {
+        command->method(command->context, &command->args);
+        last = command;
+        count++;
+    }
+
+    // Return the records to the pool
+    pthread_mutex_lock(&queue->lock);
+    last->next = queue->freeList;
+    queue->freeList = commands;
+    pthread_mutex_unlock(&queue->lock);
+
+    return count;
+}
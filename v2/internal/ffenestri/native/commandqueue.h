@@ -0,0 +1,71 @@
+#ifndef COMMANDQUEUE_H
+#define COMMANDQUEUE_H
+
+#include <pthread.h>
+#include <stdbool.h>
+
+// The number of command records allocated at a time when the pool is empty
+#define COMMANDQUEUE_BLOCK_SIZE 256
+
+// CommandArgs holds the arguments of a command inline, so queueing a command
+// doesn't need to allocate
+typedef union {
+    struct {
+        int x;
+        int y;
+    } position;
+    struct {
+        int width;
+        int height;
+    } size;
+    void *pointer;
+} CommandArgs;
+
+typedef void (*commandMethod)(void *context, CommandArgs *args);
+
+typedef struct Command {
+    struct Command *next;
+    commandMethod method;
+    void *context;
+    CommandArgs args;
+} Command;
+
+struct CommandQueue;
+typedef void (*commandQueueWakeup)(struct CommandQueue *queue);
+
+// CommandQueue is a FIFO of commands to run on the main thread. Commands may be
+// pushed from any thread. The wakeup function is called when the first command
+// is pushed onto an empty queue and must arrange for CommandQueueDrain to be
+// called on the main thread. Command records are pooled and reused.
+typedef struct CommandQueue {
+    pthread_mutex_t lock;
+
+    // Queued commands
+    Command *head;
+    Command *tail;
+
+    // Free command records
+    Command *freeList;
+
+    // The blocks of command records, for releasing the pool
+    void **blocks;
+    int blockCount;
+
+    // Set when the wakeup has been called but the queue not yet drained
+    bool wakeupPending;
+    commandQueueWakeup wakeup;
+
+    // User data for the wakeup function
+    void *data;
+
+    // Stats
+    unsigned long wakeups;
+} CommandQueue;
+
+CommandQueue* NewCommandQueue(commandQueueWakeup wakeup, void *data);
+void DeleteCommandQueue(CommandQueue *queue);
+void CommandQueuePush(CommandQueue *queue, commandMethod method, void *context, CommandArgs args);
+// CommandQueueDrain runs all queued commands in order and returns how many were run
+int CommandQueueDrain(CommandQueue *queue);
+
+#endif //COMMANDQUEUE_H
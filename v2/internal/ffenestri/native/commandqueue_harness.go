@@ -0,0 +1,160 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+/*
+#include <pthread.h>
+#include "commandqueue.h"
+
+// A stand in for the GTK main loop: a thread that drains the queue
+// whenever it is woken up
+static CommandQueue *testQueue;
+static pthread_t testMainThread;
+static pthread_mutex_t testLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t testCond = PTHREAD_COND_INITIALIZER;
+static int testWakeupPending;
+static int testStopping;
+
+// Updated by the commands, on the main thread
+static long testExecuted;
+static int testLastX;
+static int testOutOfOrder;
+
+static void testWakeup(CommandQueue *queue) {
+    pthread_mutex_lock(&testLock);
+    testWakeupPending = 1;
+    pthread_cond_signal(&testCond);
+    pthread_mutex_unlock(&testLock);
+}
+
+static void* testMainLoop(void *unused) {
+    for(;;) {
+        pthread_mutex_lock(&testLock);
+        while( !testWakeupPending && !testStopping ) {
+            pthread_cond_wait(&testCond, &testLock);
+        }
+        int stopping = testStopping && !testWakeupPending;
+        testWakeupPending = 0;
+        pthread_mutex_unlock(&testLock);
+        if( stopping ) {
+            break;
+        }
+        CommandQueueDrain(testQueue);
+    }
+    return NULL;
+}
+
+static void testStartMainThread(void) {
+    testQueue = NewCommandQueue(testWakeup, NULL);
+    testWakeupPending = 0;
+    testStopping = 0;
+    testExecuted = 0;
+    testLastX = -1;
+    testOutOfOrder = 0;
+    pthread_create(&testMainThread, NULL, testMainLoop, NULL);
+}
+
+static void testStopMainThread(void) {
+    pthread_mutex_lock(&testLock);
+    testStopping = 1;
+    pthread_cond_signal(&testCond);
+    pthread_mutex_unlock(&testLock);
+    pthread_join(testMainThread, NULL);
+    CommandQueueDrain(testQueue);
+}
+
+typedef struct {
+    long executed;
+    int outOfOrder;
+    unsigned long wakeups;
+    int blocks;
+    int freeRecords;
+} testStats;
+
+static testStats testStopMainThreadAndDelete(void) {
+    testStopMainThread();
+    int freeRecords = 0;
+    for( Command *command = testQueue->freeList; command != NULL; command = command->next ) {
+        freeRecords++;
+    }
+    testStats result = { testExecuted, testOutOfOrder, testQueue->wakeups, testQueue->blockCount, freeRecords };
+    DeleteCommandQueue(testQueue);
+    testQueue = NULL;
+    return result;
+}
+
+static void testSetPositionInternal(void *context, CommandArgs *args) {
+    // Commands from a single producer must arrive in order
+    if( args->position.x != testLastX + 1 ) {
+        testOutOfOrder++;
+    }
+    testLastX = args->position.x;
+    testExecuted++;
+}
+
+static void testCountInternal(void *context, CommandArgs *args) {
+    __atomic_fetch_add(&testExecuted, 1, __ATOMIC_RELEASE);
+}
+
+static long testExecutedCount(void) {
+    return __atomic_load_n(&testExecuted, __ATOMIC_ACQUIRE);
+}
+
+static void testSetPosition(int x, int y) {
+    CommandArgs args;
+    args.position.x = x;
+    args.position.y = y;
+    CommandQueuePush(testQueue, testSetPositionInternal, NULL, args);
+}
+
+static void testCount(void) {
+    CommandArgs args = {0};
+    CommandQueuePush(testQueue, testCountInternal, NULL, args);
+}
+*/
+import "C"
+
+// The wrappers in this file run the command queue against a fake main
+// thread for Go tests and benchmarks
+
+type commandQueueStats struct {
+	executed    int
+	outOfOrder  int
+	wakeups     int
+	blocks      int
+	freeRecords int
+}
+
+func startCommandQueue() {
+	C.testStartMainThread()
+}
+
+// stopCommandQueue drains the queue, stops the main thread and returns the stats
+func stopCommandQueue() commandQueueStats {
+	stats := C.testStopMainThreadAndDelete()
+	return commandQueueStats{
+		executed:    int(stats.executed),
+		outOfOrder:  int(stats.outOfOrder),
+		wakeups:     int(stats.wakeups),
+		blocks:      int(stats.blocks),
+		freeRecords: int(stats.freeRecords),
+	}
+}
+
+// queueSetPosition queues a SetPosition style command. Calls must be made from
+// a single goroutine with x increasing by 1 from 0.
+func queueSetPosition(x int, y int) {
+	C.testSetPosition(C.int(x), C.int(y))
+}
+
+func queueCount() {
+	C.testCount()
+}
+
+// commandsExecuted returns the number of commands run so far by the main thread
+func commandsExecuted() int {
+	return int(C.testExecutedCount())
+}
+
+const commandQueueBlockSize = int(C.COMMANDQUEUE_BLOCK_SIZE)
@@ -0,0 +1,98 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+import (
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/matryer/is"
+)
+
+func TestCommandQueueOrdering(t *testing.T) {
+	is := is.New(t)
+
+	startCommandQueue()
+	for i := 0; i < 10000; i++ {
+		queueSetPosition(i, i)
+	}
+	stats := stopCommandQueue()
+
+	is.Equal(stats.executed, 10000)
+	is.Equal(stats.outOfOrder, 0)
+	is.True(stats.wakeups >= 1)
+	is.True(stats.wakeups <= 10000)
+}
+
+func TestCommandQueueMultipleProducers(t *testing.T) {
+	is := is.New(t)
+
+	startCommandQueue()
+	var wg sync.WaitGroup
+	for i := 0; i < 8; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for j := 0; j < 5000; j++ {
+				queueCount()
+			}
+		}()
+	}
+	wg.Wait()
+	stats := stopCommandQueue()
+
+	is.Equal(stats.executed, 40000)
+}
+
+func TestCommandQueueReusesRecords(t *testing.T) {
+	is := is.New(t)
+
+	// Several times a block of commands in total, drained in batches
+	const batch = 100
+	const batches = 10 * commandQueueBlockSize / batch
+	startCommandQueue()
+	for i := 1; i <= batches; i++ {
+		for j := 0; j < batch; j++ {
+			queueCount()
+		}
+		deadline := time.Now().Add(5 * time.Second)
+		for commandsExecuted() < i*batch {
+			if time.Now().After(deadline) {
+				t.Fatalf("batch %d was not drained", i)
+			}
+			time.Sleep(time.Millisecond)
+		}
+	}
+	stats := stopCommandQueue()
+
+	// Drained records go back to the free list and are reused, so the
+	// first block is all that is allocated
+	is.Equal(stats.executed, batches*batch)
+	is.Equal(stats.blocks, 1)
+	is.Equal(stats.freeRecords, commandQueueBlockSize)
+}
+
+// BenchmarkSetPositionStorm queues 100k SetPosition calls from a goroutine
+func BenchmarkSetPositionStorm(b *testing.B) {
+	const calls = 100000
+	wakeups := 0
+	for i := 0; i < b.N; i++ {
+		startCommandQueue()
+		done := make(chan struct{})
+		go func() {
+			for x := 0; x < calls; x++ {
+				queueSetPosition(x, x)
+			}
+			close(done)
+		}()
+		<-done
+		stats := stopCommandQueue()
+		if stats.executed != calls || stats.outOfOrder != 0 {
+			b.Fatalf("executed %d commands, %d out of order", stats.executed, stats.outOfOrder)
+		}
+		wakeups += stats.wakeups
+	}
+	b.ReportMetric(float64(wakeups)/float64(b.N), "wakeups/op")
+}
@@ -0,0 +1,6 @@
+// Package native holds the parts of ffenestri's C code that don't need a
+// GUI toolkit. ffenestri builds the sources into itself through native.c.
+// This package builds them on their own, so that they can be tested without
+// gtk, webkit or the generated headers. Its Go code only exists for the
+// tests and nothing else imports it.
+package native
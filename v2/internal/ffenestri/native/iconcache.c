@@ -0,0 +1,182 @@
+// +build !windows
+
+#include <string.h>
+#include "native.h"
+#include "iconcache.h"
+
+// FNV-1a
+static uint64_t iconHash(const unsigned char *data, size_t length) {
+    uint64_t hash = 14695981039346656037ULL;
+    for( size_t index = 0; index < length; index++ ) {
+        hash ^= data[index];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void InitIconCache(IconCache *cache, IconDecodeFunc decode, IconReleaseFunc release) {
+    cache->decode = decode;
+    cache->release = release;
+    cache->hash = iconHash;
+    cache->list = NULL;
+    cache->dynamicEntries = 0;
+    cache->decodes = 0;
+    if( 0 != hashmap_create((const unsigned)16, &cache->entries) || 0 != hashmap_create((const unsigned)16, &cache->names) ) {
+        ABORT("Not enough memory to allocate icon cache!");
+    }
+}
+
+// Returns the entry for the given data or NULL. first is set to the first
+// entry with the same key, if any, which a new entry is chained to.
+static IconCacheEntry* findEntry(IconCache *cache, const unsigned char *data, size_t length, int flags, IconCacheKey *key, IconCacheEntry **first) {
+    key->hash = cache->hash(data, length);
+    key->length = length;
+    key->flags = flags;
+    *first = hashmap_get(&cache->entries, (const char*)key, sizeof(IconCacheKey));
+    for( IconCacheEntry *entry = *first; entry != NULL; entry = entry->sameKey ) {
+        if( memcmp(entry->data, data, length) == 0 ) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Adds an entry for data. Dynamic entries copy it, named ones keep the
+// pointer.
+static IconCacheEntry* addEntry(IconCache *cache, IconCacheKey *key, IconCacheEntry *first, const unsigned char *data, bool named) {
+    IconCacheEntry *entry = calloc(1, sizeof(IconCacheEntry));
+    if( entry == NULL ) {
+        ABORT("Not enough memory to allocate icon cache entry!");
+    }
+    entry->key = *key;
+    entry->named = named;
+    entry->data = data;
+    if( !named ) {
+        unsigned char *copy = malloc(key->length > 0 ? key->length : 1);
+        if( copy == NULL ) {
+            ABORT("Not enough memory to allocate icon cache entry!");
+        }
+        memcpy(copy, data, key->length);
+        entry->data = copy;
+    }
+    entry->next = cache->list;
+    cache->list = entry;
+
+    if( first != NULL ) {
+        entry->sameKey = first->sameKey;
+        first->sameKey = entry;
+        return entry;
+    }
+
+    // The entry holds its own key so it lives as long as the map element
+    if( 0 != hashmap_put(&cache->entries, (const char*)&entry->key, sizeof(IconCacheKey), entry) ) {
+        ABORT("Not enough memory to add to icon cache!");
+    }
+    return entry;
+}
+
+// Removes entry from the entries map, putting the next entry with the same
+// key in its place if it was the first
+static void removeEntry(IconCache *cache, IconCacheEntry *entry) {
+    IconCacheEntry *first = hashmap_get(&cache->entries, (const char*)&entry->key, sizeof(IconCacheKey));
+    if( first != entry ) {
+        IconCacheEntry *previous = first;
+        while( previous->sameKey != entry ) {
+            previous = previous->sameKey;
+        }
+        previous->sameKey = entry->sameKey;
+        return;
+    }
+    hashmap_remove(&cache->entries, (const char*)&entry->key, sizeof(IconCacheKey));
+    if( entry->sameKey != NULL && 0 != hashmap_put(&cache->entries, (const char*)&entry->sameKey->key, sizeof(IconCacheKey), entry->sameKey) ) {
+        ABORT("Not enough memory to add to icon cache!");
+    }
+}
+
+static void freeEntry(IconCache *cache, IconCacheEntry *entry) {
+    if( entry->image != NULL ) {
+        cache->release(entry->image);
+    }
+    if( !entry->named ) {
+        free((void*)entry->data);
+    }
+    free(entry);
+}
+
+// Releases the images of entries not registered by name and removes them
+static void flushDynamicEntries(IconCache *cache) {
+    IconCacheEntry **link = &cache->list;
+    while( *link != NULL ) {
+        IconCacheEntry *entry = *link;
+        if( entry->named ) {
+            link = &entry->next;
+            continue;
+        }
+        *link = entry->next;
+        removeEntry(cache, entry);
+        freeEntry(cache, entry);
+    }
+    cache->dynamicEntries = 0;
+}
+
+void IconCacheAddNamed(IconCache *cache, const char *name, const unsigned char *data, size_t length, int flags) {
+    IconCacheKey key;
+    IconCacheEntry *first;
+    IconCacheEntry *entry = findEntry(cache, data, length, flags, &key, &first);
+    if( entry == NULL ) {
+        entry = addEntry(cache, &key, first, data, true);
+    } else if( !entry->named ) {
+        // Adopt the dynamic entry so it survives flushes. The embedded data
+        // replaces its copy.
+        free((void*)entry->data);
+        entry->data = data;
+        entry->named = true;
+        cache->dynamicEntries--;
+    }
+    if( 0 != hashmap_put(&cache->names, name, strlen(name), entry) ) {
+        ABORT("Not enough memory to add to icon cache!");
+    }
+}
+
+void* IconCacheGetNamed(IconCache *cache, const char *name) {
+    IconCacheEntry *entry = hashmap_get(&cache->names, name, strlen(name));
+    if( entry == NULL ) {
+        return NULL;
+    }
+    if( entry->image == NULL ) {
+        entry->image = cache->decode(entry->data, entry->key.length, (int)entry->key.flags);
+        cache->decodes++;
+    }
+    return entry->image;
+}
+
+void* IconCacheGet(IconCache *cache, const unsigned char *data, size_t length, int flags) {
+    IconCacheKey key;
+    IconCacheEntry *first;
+    IconCacheEntry *entry = findEntry(cache, data, length, flags, &key, &first);
+    if( entry == NULL ) {
+        if( cache->dynamicEntries >= ICONCACHE_MAX_DYNAMIC ) {
+            flushDynamicEntries(cache);
+            first = hashmap_get(&cache->entries, (const char*)&key, sizeof(IconCacheKey));
+        }
+        entry = addEntry(cache, &key, first, data, false);
+        cache->dynamicEntries++;
+    }
+    if( entry->image == NULL ) {
+        entry->image = cache->decode(data, length, flags);
+        cache->decodes++;
+    }
+    return entry->image;
+}
+
+void DestroyIconCache(IconCache *cache) {
+    IconCacheEntry *entry = cache->list;
+    while( entry != NULL ) {
+        IconCacheEntry *next = entry->next;
+        freeEntry(cache, entry);
+        entry = next;
+    }
+    cache->list = NULL;
+    hashmap_destroy(&cache->entries);
+    hashmap_destroy(&cache->names);
+}
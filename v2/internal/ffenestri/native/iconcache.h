@@ -0,0 +1,99 @@
+#ifndef ICONCACHE_H
+#define ICONCACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "../hashmap.h"
+
+// The maximum number of images decoded from data passed to IconCacheGet that
+// are kept. When exceeded, they are all released and decoded again on demand.
+#define ICONCACHE_MAX_DYNAMIC 64
+
+// Flags passed through to the decoder. Images are cached per flags, so the
+// same data decoded with different flags gives different images.
+#define ICONCACHE_BASE64   1
+#define ICONCACHE_TEMPLATE 2
+
+// Decodes length bytes of image data into a platform image. The cache owns
+// the result and hands it to the release function when done with it.
+typedef void* (*IconDecodeFunc)(const unsigned char *data, size_t length, int flags);
+typedef void (*IconReleaseFunc)(void *image);
+typedef uint64_t (*IconHashFunc)(const unsigned char *data, size_t length);
+
+// The key of a cache entry. Entries are found by the hash of their content,
+// then compared byte for byte, as different data can have the same key.
+typedef struct {
+    uint64_t hash;
+    uint64_t length;
+    uint64_t flags;
+} IconCacheKey;
+
+typedef struct IconCacheEntry {
+    IconCacheKey key;
+
+    // The data the image is decoded from, which lookups compare with. Named
+    // icons point to the data embedded in the binary, other entries own a
+    // copy.
+    const unsigned char *data;
+
+    // The decoded image or NULL if not decoded yet
+    void *image;
+
+    bool named;
+
+    struct IconCacheEntry *next;
+
+    // The next entry with the same key but different data
+    struct IconCacheEntry *sameKey;
+} IconCacheEntry;
+
+// IconCache holds decoded icons keyed by the hash of their data so that the
+// same image is only decoded once, however many times it is set on a tray or
+// menu item. Icons embedded in the binary can be registered by name, which
+// doesn't decode them until they are first looked up. The cache isn't thread
+// safe: it is expected to be used from the main thread only.
+typedef struct {
+
+    IconDecodeFunc decode;
+    IconReleaseFunc release;
+
+    // Set to an FNV-1a hash by InitIconCache. Tests replace it to make
+    // entries collide.
+    IconHashFunc hash;
+
+    // The first entry with each IconCacheKey
+    struct hashmap_s entries;
+
+    // Entries by icon name. Names with the same data share an entry.
+    struct hashmap_s names;
+
+    // All entries, most recently added first
+    IconCacheEntry *list;
+
+    // The number of entries not created by name
+    int dynamicEntries;
+
+    // The number of times decode has been called
+    int decodes;
+
+} IconCache;
+
+void InitIconCache(IconCache *cache, IconDecodeFunc decode, IconReleaseFunc release);
+
+// Registers embedded image data under the given name. Neither name nor data
+// are copied so must live as long as the cache.
+void IconCacheAddNamed(IconCache *cache, const char *name, const unsigned char *data, size_t length, int flags);
+
+// Returns the image registered under name, decoding it if needed, or NULL if
+// there is no such icon
+void* IconCacheGetNamed(IconCache *cache, const char *name);
+
+// Returns the image for the given data, decoding it only if the same data
+// hasn't been seen before with the same flags. data is copied.
+void* IconCacheGet(IconCache *cache, const unsigned char *data, size_t length, int flags);
+
+// Releases all images and frees the cache's memory
+void DestroyIconCache(IconCache *cache);
+
+#endif //ICONCACHE_H
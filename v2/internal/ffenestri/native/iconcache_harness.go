@@ -0,0 +1,118 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+/*
+#include <stdlib.h>
+#include <string.h>
+#include "iconcache.h"
+
+// The stub image backend used by the tests. An image is a copy of the data
+// it was decoded from, prefixed with the flags.
+static int stubIconsLive = 0;
+
+static void* stubDecodeIcon(const unsigned char *data, size_t length, int flags) {
+    unsigned char *image = malloc(length + 2);
+    image[0] = (unsigned char)('0' + flags);
+    memcpy(image + 1, data, length);
+    image[length + 1] = 0;
+    stubIconsLive++;
+    return image;
+}
+
+static void stubReleaseIcon(void *image) {
+    free(image);
+    stubIconsLive--;
+}
+
+static void initStubIconCache(IconCache *cache) {
+    InitIconCache(cache, stubDecodeIcon, stubReleaseIcon);
+}
+
+// Gives all data the same hash, so that entries collide
+static uint64_t stubCollidingHash(const unsigned char *data, size_t length) {
+    return 1;
+}
+
+static void collideStubIcons(IconCache *cache) {
+    cache->hash = stubCollidingHash;
+}
+
+static int liveStubIcons() {
+    return stubIconsLive;
+}
+*/
+import "C"
+
+import "unsafe"
+
+// iconCache wraps a native IconCache using a stub image backend so that the
+// cache logic can be tested without a platform image library
+type iconCache struct {
+	cache C.IconCache
+
+	// Named data must outlive the cache
+	named []unsafe.Pointer
+}
+
+func newIconCache() *iconCache {
+	result := &iconCache{}
+	C.initStubIconCache(&result.cache)
+	return result
+}
+
+func (i *iconCache) addNamed(name string, data string, flags int) {
+	cname := C.CString(name)
+	cdata := C.CString(data)
+	i.named = append(i.named, unsafe.Pointer(cname), unsafe.Pointer(cdata))
+	C.IconCacheAddNamed(&i.cache, cname, (*C.uchar)(unsafe.Pointer(cdata)), C.size_t(len(data)), C.int(flags))
+}
+
+// getNamed returns the stub image for the named icon and whether it exists
+func (i *iconCache) getNamed(name string) (string, bool) {
+	cname := C.CString(name)
+	defer C.free(unsafe.Pointer(cname))
+	image := C.IconCacheGetNamed(&i.cache, cname)
+	if image == nil {
+		return "", false
+	}
+	return C.GoString((*C.char)(image)), true
+}
+
+// get returns the stub image for the given data and its address, which
+// identifies the decoded image
+func (i *iconCache) get(data string, flags int) (string, uintptr) {
+	cdata := C.CString(data)
+	defer C.free(unsafe.Pointer(cdata))
+	image := C.IconCacheGet(&i.cache, (*C.uchar)(unsafe.Pointer(cdata)), C.size_t(len(data)), C.int(flags))
+	return C.GoString((*C.char)(image)), uintptr(image)
+}
+
+// collide makes all data hash the same
+func (i *iconCache) collide() {
+	C.collideStubIcons(&i.cache)
+}
+
+func (i *iconCache) decodes() int {
+	return int(i.cache.decodes)
+}
+
+func (i *iconCache) destroy() {
+	C.DestroyIconCache(&i.cache)
+	for _, ptr := range i.named {
+		C.free(ptr)
+	}
+	i.named = nil
+}
+
+// liveIcons returns the number of stub images decoded and not yet released
+func liveIcons() int {
+	return int(C.liveStubIcons())
+}
+
+const (
+	iconBase64   = int(C.ICONCACHE_BASE64)
+	iconTemplate = int(C.ICONCACHE_TEMPLATE)
+	maxDynamic   = int(C.ICONCACHE_MAX_DYNAMIC)
+)
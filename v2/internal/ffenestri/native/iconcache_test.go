@@ -0,0 +1,132 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/matryer/is"
+)
+
+func TestIconCacheNamed(t *testing.T) {
+	is := is.New(t)
+
+	cache := newIconCache()
+	defer cache.destroy()
+
+	cache.addNamed("info", "info-png", 0)
+	cache.addNamed("warning", "warning-png", 0)
+	cache.addNamed("info-light", "info-png", 0)
+
+	// Nothing is decoded until used
+	is.Equal(cache.decodes(), 0)
+
+	image, ok := cache.getNamed("info")
+	is.True(ok)
+	is.Equal(image, "0info-png")
+	is.Equal(cache.decodes(), 1)
+
+	// Names with the same data share the image
+	image, ok = cache.getNamed("info-light")
+	is.True(ok)
+	is.Equal(image, "0info-png")
+	is.Equal(cache.decodes(), 1)
+
+	_, ok = cache.getNamed("missing")
+	is.True(!ok)
+	is.Equal(cache.decodes(), 1)
+}
+
+func TestIconCacheContent(t *testing.T) {
+	is := is.New(t)
+
+	cache := newIconCache()
+	defer cache.destroy()
+
+	first, firstImage := cache.get("aGVsbG8=", iconBase64)
+	is.Equal(first, "1aGVsbG8=")
+	_, again := cache.get("aGVsbG8=", iconBase64)
+	is.Equal(again, firstImage)
+	is.Equal(cache.decodes(), 1)
+
+	// Flags are part of the key
+	template, _ := cache.get("aGVsbG8=", iconBase64|iconTemplate)
+	is.Equal(template, "3aGVsbG8=")
+	is.Equal(cache.decodes(), 2)
+
+	// Named data is found by content too
+	cache.addNamed("tray", "aGVsbG8=", iconBase64)
+	image, _ := cache.getNamed("tray")
+	is.Equal(image, "1aGVsbG8=")
+	is.Equal(cache.decodes(), 2)
+}
+
+func TestIconCacheFlush(t *testing.T) {
+	is := is.New(t)
+
+	live := liveIcons()
+	cache := newIconCache()
+	cache.addNamed("named", "named", 0)
+	cache.getNamed("named")
+	for i := 0; i <= maxDynamic; i++ {
+		cache.get(fmt.Sprintf("frame-%d", i), 0)
+	}
+
+	// The dynamic images were flushed when the limit was hit
+	is.Equal(liveIcons()-live, 2)
+	image, _ := cache.getNamed("named")
+	is.Equal(image, "0named")
+
+	cache.get("frame-0", 0)
+	is.Equal(cache.decodes(), maxDynamic+3)
+
+	cache.destroy()
+	is.Equal(liveIcons(), live)
+}
+
+func TestIconCacheCollisions(t *testing.T) {
+	is := is.New(t)
+
+	live := liveIcons()
+	cache := newIconCache()
+	cache.collide()
+
+	// Data with the same key is told apart by content
+	cache.addNamed("named", "name", 0)
+	first, firstImage := cache.get("aaaa", 0)
+	is.Equal(first, "0aaaa")
+	second, _ := cache.get("bbbb", 0)
+	is.Equal(second, "0bbbb")
+	_, again := cache.get("aaaa", 0)
+	is.Equal(again, firstImage)
+	image, _ := cache.getNamed("named")
+	is.Equal(image, "0name")
+	is.Equal(cache.decodes(), 3)
+
+	// Flushing unchains the dynamic entries, leaving the named one
+	for i := 0; i <= maxDynamic; i++ {
+		cache.get(fmt.Sprintf("%04d", i), 0)
+	}
+	image, _ = cache.getNamed("named")
+	is.Equal(image, "0name")
+	frame, _ := cache.get("0001", 0)
+	is.Equal(frame, "00001")
+
+	cache.destroy()
+	is.Equal(liveIcons(), live)
+}
+
+// BenchmarkTrayUpdates sets a tray icon animated over a few frames, counting
+// decodes per update
+func BenchmarkTrayUpdates(b *testing.B) {
+	frames := []string{"ZnJhbWUx", "ZnJhbWUy", "ZnJhbWUz", "ZnJhbWU0"}
+	cache := newIconCache()
+	defer cache.destroy()
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		cache.get(frames[i%len(frames)], iconBase64)
+	}
+	b.ReportMetric(float64(cache.decodes())/float64(b.N), "decodes/update")
+}
@@ -0,0 +1,186 @@
+// +build !windows
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "logger.h"
+
+volatile int ffenestriLogLevel = LOG_LEVEL_ERROR;
+
+// The log buffer is a bounded multi-producer, single-consumer ring.
+// Each slot's sequence number says whether it is free to write (== position)
+// or ready to read (== position + 1).
+// Credit: Dmitry Vyukov's bounded MPMC queue
+typedef struct {
+    atomic_size_t sequence;
+    int level;
+    char message[LOG_MESSAGE_SIZE];
+} logSlot;
+
+static logSlot logBuffer[LOG_BUFFER_SIZE];
+static atomic_size_t logWritePosition;
+static size_t logReadPosition;
+static atomic_size_t logDropped;
+static pthread_once_t logBufferOnce = PTHREAD_ONCE_INIT;
+
+// Only one thread may read the buffer at a time
+static pthread_mutex_t logReadLock = PTHREAD_MUTEX_INITIALIZER;
+static logSink currentSink = NULL;
+
+static pthread_t logThread;
+static atomic_bool logThreadRunning;
+
+// The logging thread waits on logWake while the buffer is empty. Writers
+// only signal it when logThreadWaiting is set.
+static pthread_mutex_t logWakeLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t logWake = PTHREAD_COND_INITIALIZER;
+static atomic_bool logThreadWaiting;
+
+static void initLogBuffer(void) {
+    for( size_t i = 0; i < LOG_BUFFER_SIZE; i++ ) {
+        atomic_store_explicit(&logBuffer[i].sequence, i, memory_order_relaxed);
+    }
+    atomic_store(&logWritePosition, 0);
+    logReadPosition = 0;
+}
+
+void SetLogLevel(int level) {
+    ffenestriLogLevel = level;
+}
+
+void logWrite(int level, const char *format, ...) {
+    pthread_once(&logBufferOnce, initLogBuffer);
+
+    size_t position = atomic_load_explicit(&logWritePosition, memory_order_relaxed);
+    logSlot *slot;
+    for(;;) {
+        slot = &logBuffer[position & (LOG_BUFFER_SIZE - 1)];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+        if( difference == 0 ) {
+            // The slot is free: try to claim it
+            if( atomic_compare_exchange_weak_explicit(&logWritePosition, &position, position + 1, memory_order_relaxed, memory_order_relaxed) ) {
+                break;
+            }
+        } else if( difference < 0 ) {
+            // The buffer is full
+            atomic_fetch_add_explicit(&logDropped, 1, memory_order_relaxed);
+            return;
+        } else {
+            position = atomic_load_explicit(&logWritePosition, memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    va_list args;
+    va_start(args, format);
+    vsnprintf(slot->message, LOG_MESSAGE_SIZE, format, args);
+    va_end(args);
+
+    // Publish the message
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+
+    // Wake the logging thread if it is waiting for a message. The fence
+    // pairs with the one in waitForMessages, so either the thread sees this
+    // message or this sees the thread waiting.
+    atomic_thread_fence(memory_order_seq_cst);
+    if( atomic_load_explicit(&logThreadWaiting, memory_order_relaxed) ) {
+        pthread_mutex_lock(&logWakeLock);
+        pthread_cond_signal(&logWake);
+        pthread_mutex_unlock(&logWakeLock);
+    }
+}
+
+// drainLogBuffer writes all published messages to the sink.
+// Returns the number of messages written.
+static size_t drainLogBuffer(void) {
+    size_t count = 0;
+    pthread_mutex_lock(&logReadLock);
+    for(;;) {
+        logSlot *slot = &logBuffer[logReadPosition & (LOG_BUFFER_SIZE - 1)];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        if( sequence != logReadPosition + 1 ) {
+            break;
+        }
+        if( currentSink != NULL ) {
+            currentSink(slot->level, slot->message);
+        }
+        // Release the slot for the next lap of the ring
+        atomic_store_explicit(&slot->sequence, logReadPosition + LOG_BUFFER_SIZE, memory_order_release);
+        logReadPosition++;
+        count++;
+    }
+    pthread_mutex_unlock(&logReadLock);
+    return count;
+}
+
+// logBufferEmpty returns true if there is no published message to read
+static bool logBufferEmpty(void) {
+    pthread_mutex_lock(&logReadLock);
+    logSlot *slot = &logBuffer[logReadPosition & (LOG_BUFFER_SIZE - 1)];
+    bool result = atomic_load_explicit(&slot->sequence, memory_order_acquire) != logReadPosition + 1;
+    pthread_mutex_unlock(&logReadLock);
+    return result;
+}
+
+// waitForMessages blocks until a message is logged or the logger stops
+static void waitForMessages(void) {
+    pthread_mutex_lock(&logWakeLock);
+    atomic_store_explicit(&logThreadWaiting, true, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    while( atomic_load(&logThreadRunning) && logBufferEmpty() ) {
+        pthread_cond_wait(&logWake, &logWakeLock);
+    }
+    atomic_store_explicit(&logThreadWaiting, false, memory_order_relaxed);
+    pthread_mutex_unlock(&logWakeLock);
+}
+
+static void* logThreadMain(void *unused) {
+    while( atomic_load(&logThreadRunning) ) {
+        if( drainLogBuffer() == 0 ) {
+            waitForMessages();
+        }
+    }
+    return NULL;
+}
+
+void LogStart(logSink sink) {
+    pthread_once(&logBufferOnce, initLogBuffer);
+
+    pthread_mutex_lock(&logReadLock);
+    currentSink = sink;
+    pthread_mutex_unlock(&logReadLock);
+
+    bool expected = false;
+    if( !atomic_compare_exchange_strong(&logThreadRunning, &expected, true) ) {
+        // Already running
+        return;
+    }
+    if( pthread_create(&logThread, NULL, logThreadMain, NULL) != 0 ) {
+        // Fall back to writing on LogFlush / LogStop
+        atomic_store(&logThreadRunning, false);
+    }
+}
+
+void LogStop(void) {
+    bool expected = true;
+    if( atomic_compare_exchange_strong(&logThreadRunning, &expected, false) ) {
+        pthread_mutex_lock(&logWakeLock);
+        pthread_cond_signal(&logWake);
+        pthread_mutex_unlock(&logWakeLock);
+        pthread_join(logThread, NULL);
+    }
+    LogFlush();
+}
+
+void LogFlush(void) {
+    pthread_once(&logBufferOnce, initLogBuffer);
+    drainLogBuffer();
+}
+
+size_t LogDropped(void) {
+    return atomic_load(&logDropped);
+}
@@ -0,0 +1,63 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <stddef.h>
+
+// Log levels. These match the levels of the Go logger.
+#define LOG_LEVEL_TRACE 1
+#define LOG_LEVEL_DEBUG 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_WARNING 4
+#define LOG_LEVEL_ERROR 5
+#define LOG_LEVEL_FATAL 6
+
+// Messages below this level are compiled out entirely.
+// Production builds raise it (see logger_production.go).
+#ifndef FFENESTRI_LOG_MIN_LEVEL
+#define FFENESTRI_LOG_MIN_LEVEL LOG_LEVEL_TRACE
+#endif
+
+// The maximum length of a single log message. Longer messages are truncated.
+#define LOG_MESSAGE_SIZE 256
+
+// The number of messages that may be waiting to be written. Must be a power of 2.
+// Messages logged while the buffer is full are dropped.
+#define LOG_BUFFER_SIZE 1024
+
+#define LOG_LIKELY(x) __builtin_expect(!!(x), 1)
+#define LOG_UNLIKELY(x) __builtin_expect(!!(x), 0)
+
+// The runtime log level. Defaults to LOG_LEVEL_ERROR.
+extern volatile int ffenestriLogLevel;
+
+// LOG_ENABLED is a compile time constant for levels below FFENESTRI_LOG_MIN_LEVEL
+#define LOG_ENABLED(level) ((level) >= FFENESTRI_LOG_MIN_LEVEL && LOG_UNLIKELY((level) >= ffenestriLogLevel))
+
+// LOG works like printf. Arguments are only evaluated if the level is enabled.
+#define LOG(level, ...) do { if (LOG_ENABLED(level)) { logWrite(level, __VA_ARGS__); } } while (0)
+
+#define LOG_TRACE(...) LOG(LOG_LEVEL_TRACE, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define LOG_INFO(...) LOG(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_WARNING(...) LOG(LOG_LEVEL_WARNING, __VA_ARGS__)
+#define LOG_ERROR(...) LOG(LOG_LEVEL_ERROR, __VA_ARGS__)
+// Fatal messages are written before LOG_FATAL returns
+#define LOG_FATAL(...) do { logWrite(LOG_LEVEL_FATAL, __VA_ARGS__); LogFlush(); } while (0)
+
+// A logSink receives formatted messages on the logging thread
+typedef void (*logSink)(int level, const char *message);
+
+// LogStart starts the background thread that writes buffered messages to the sink
+void LogStart(logSink sink);
+// LogStop writes any buffered messages and stops the background thread
+void LogStop(void);
+// LogFlush writes any buffered messages on the calling thread
+void LogFlush(void);
+// LogDropped returns the number of messages dropped because the buffer was full
+size_t LogDropped(void);
+void SetLogLevel(int level);
+
+// logWrite formats the message into the log buffer. It never blocks. Use the LOG macros.
+void logWrite(int level, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+#endif //LOGGER_H
@@ -0,0 +1,118 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+/*
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "logger.h"
+
+// testLogSink records the messages it receives
+static char testLogOutput[LOG_BUFFER_SIZE * 8];
+static size_t testLogMessages;
+
+static void testLogSink(int level, const char *message) {
+    size_t length = strlen(testLogOutput);
+    snprintf(testLogOutput + length, sizeof(testLogOutput) - length, "%d:%s\n", level, message);
+    __atomic_fetch_add(&testLogMessages, 1, __ATOMIC_RELEASE);
+}
+
+static int testLogCount(void) {
+    return (int)__atomic_load_n(&testLogMessages, __ATOMIC_ACQUIRE);
+}
+
+static void discardLogSink(int level, const char *message) {}
+
+static void startTestLog(int record) {
+    testLogOutput[0] = '\0';
+    testLogMessages = 0;
+    LogStart(record ? testLogSink : discardLogSink);
+}
+
+static const char* testLogResult(int *messages) {
+    *messages = (int)testLogMessages;
+    return testLogOutput;
+}
+
+typedef struct {
+    unsigned int button;
+    double x_root;
+    double y_root;
+    unsigned int time;
+} mouseEvent;
+
+static int formatCount;
+
+static const char* describeEvent(mouseEvent *event) {
+    formatCount++;
+    return "button press";
+}
+
+// mouseEventStorm logs every event in the same way as printEvent in ffenestri_linux.c
+static int mouseEventStorm(int count) {
+    mouseEvent event = {1, 0, 0, 0};
+    formatCount = 0;
+    for( int i = 0; i < count; i++ ) {
+        event.x_root = i;
+        event.y_root = i;
+        event.time = i;
+        LOG_TRACE("%s: [button:%d] [x:%f] [y:%f] [time:%d]", describeEvent(&event), event.button, event.x_root, event.y_root, event.time);
+    }
+    return formatCount;
+}
+
+static void logTestMessage(int level, int value) {
+    LOG(level, "message %d", value);
+}
+*/
+import "C"
+
+// The wrappers in this file expose the native logger to Go tests and benchmarks
+
+func startTestLog(record bool) {
+	flag := 0
+	if record {
+		flag = 1
+	}
+	C.startTestLog(C.int(flag))
+}
+
+func stopTestLog() (output string, messages int) {
+	C.LogStop()
+	var count C.int
+	output = C.GoString(C.testLogResult(&count))
+	return output, int(count)
+}
+
+// loggedMessages returns the number of messages the logging thread has
+// written since startTestLog
+func loggedMessages() int {
+	return int(C.testLogCount())
+}
+
+func setLogLevel(level int) {
+	C.SetLogLevel(C.int(level))
+}
+
+func logTestMessage(level int, value int) {
+	C.logTestMessage(C.int(level), C.int(value))
+}
+
+func logDropped() int {
+	return int(C.LogDropped())
+}
+
+// mouseEventStorm logs `count` mouse events at trace level and returns
+// the number of times the log arguments were evaluated
+func mouseEventStorm(count int) int {
+	return int(C.mouseEventStorm(C.int(count)))
+}
+
+const (
+	logLevelTrace = int(C.LOG_LEVEL_TRACE)
+	logLevelInfo  = int(C.LOG_LEVEL_INFO)
+	logLevelError = int(C.LOG_LEVEL_ERROR)
+	logBufferSize = int(C.LOG_BUFFER_SIZE)
+)
@@ -0,0 +1,109 @@
+//go:build !windows && !production
+// +build !windows,!production
+
+package native
+
+import (
+	"fmt"
+	"strings"
+	"testing"
+	"time"
+
+	"github.com/matryer/is"
+)
+
+func TestLogLevels(t *testing.T) {
+	is := is.New(t)
+
+	startTestLog(true)
+	setLogLevel(logLevelInfo)
+	logTestMessage(logLevelTrace, 1)
+	logTestMessage(logLevelInfo, 2)
+	logTestMessage(logLevelError, 3)
+	setLogLevel(logLevelError)
+	logTestMessage(logLevelInfo, 4)
+	output, messages := stopTestLog()
+
+	is.Equal(messages, 2)
+	is.Equal(output, fmt.Sprintf("%d:message 2\n%d:message 3\n", logLevelInfo, logLevelError))
+}
+
+func TestLogArgumentsNotEvaluatedWhenOff(t *testing.T) {
+	is := is.New(t)
+
+	startTestLog(true)
+	setLogLevel(logLevelError)
+	is.Equal(mouseEventStorm(100), 0)
+	setLogLevel(logLevelTrace)
+	is.Equal(mouseEventStorm(100), 100)
+	setLogLevel(logLevelError)
+	_, messages := stopTestLog()
+	is.Equal(messages, 100)
+}
+
+func TestLogOrderingAndOverflow(t *testing.T) {
+	is := is.New(t)
+
+	// Without the logging thread nothing drains the buffer
+	setLogLevel(logLevelTrace)
+	dropped := logDropped()
+	for i := 0; i < logBufferSize+10; i++ {
+		logTestMessage(logLevelTrace, i)
+	}
+	setLogLevel(logLevelError)
+	is.Equal(logDropped()-dropped, 10)
+
+	startTestLog(true)
+	output, messages := stopTestLog()
+	is.Equal(messages, logBufferSize)
+	lines := strings.Split(strings.TrimSpace(output), "\n")
+	for i, line := range lines {
+		is.Equal(line, fmt.Sprintf("%d:message %d", logLevelTrace, i))
+	}
+}
+
+func TestLogThreadWakesForMessages(t *testing.T) {
+	is := is.New(t)
+
+	startTestLog(true)
+	setLogLevel(logLevelInfo)
+	for i := 0; i < 3; i++ {
+		// Give the logging thread time to go idle
+		time.Sleep(20 * time.Millisecond)
+		logTestMessage(logLevelInfo, i)
+		deadline := time.Now().Add(5 * time.Second)
+		for loggedMessages() != i+1 {
+			if time.Now().After(deadline) {
+				t.Fatalf("message %d was not written by the logging thread", i)
+			}
+			time.Sleep(time.Millisecond)
+		}
+	}
+	setLogLevel(logLevelError)
+	_, messages := stopTestLog()
+	is.Equal(messages, 3)
+}
+
+func BenchmarkMouseEventStorm(b *testing.B) {
+	for _, test := range []struct {
+		name  string
+		level int
+	}{
+		{"off", logLevelError},
+		{"on", logLevelTrace},
+	} {
+		b.Run(test.name, func(b *testing.B) {
+			startTestLog(false)
+			setLogLevel(test.level)
+			dropped := logDropped()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				mouseEventStorm(100)
+			}
+			b.StopTimer()
+			setLogLevel(logLevelError)
+			stopTestLog()
+			b.ReportMetric(float64(logDropped()-dropped)/float64(b.N), "dropped/op")
+		})
+	}
+}
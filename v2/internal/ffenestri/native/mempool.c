@@ -0,0 +1,83 @@
+// +build !windows
+
+#include <string.h>
+#include "native.h"
+#include "mempool.h"
+
+// All allocations are aligned to this boundary
+#define MEMPOOL_ALIGNMENT (2 * sizeof(void*))
+#define MEMPOOL_ALIGN(size) (((size) + MEMPOOL_ALIGNMENT - 1) & ~(MEMPOOL_ALIGNMENT - 1))
+#define MEMPOOL_HEADER_SIZE MEMPOOL_ALIGN(sizeof(MemPoolBlock))
+
+void InitMemPool(MemPool *pool, size_t blockSize) {
+    pool->blocks = NULL;
+    pool->blockSize = blockSize > 0 ? blockSize : MEMPOOL_DEFAULT_BLOCK_SIZE;
+    pool->allocations = 0;
+}
+
+MemPoolBlock* newMemPoolBlock(MemPool *pool, size_t size) {
+    MemPoolBlock *block = malloc(MEMPOOL_HEADER_SIZE + size);
+    if( block == NULL ) {
+        ABORT("[MemPoolAlloc] Not enough memory to allocate block of %zu bytes!", size);
+    }
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    pool->allocations++;
+    return block;
+}
+
+void* MemPoolAlloc(MemPool *pool, size_t size) {
+
+    size = MEMPOOL_ALIGN(size > 0 ? size : 1);
+
+    MemPoolBlock *block = pool->blocks;
+
+    // Fast path: carve from the current block
+    if( block != NULL && block->size - block->used >= size ) {
+        void *result = (char*)block + MEMPOOL_HEADER_SIZE + block->used;
+        block->used += size;
+        return result;
+    }
+
+    // Oversized requests get a dedicated block. It goes behind the
+    // current block so that the space left there isn't wasted.
+    if( size > pool->blockSize ) {
+        MemPoolBlock *large = newMemPoolBlock(pool, size);
+        large->used = size;
+        if( block == NULL ) {
+            pool->blocks = large;
+        } else {
+            large->next = block->next;
+            block->next = large;
+        }
+        return (char*)large + MEMPOOL_HEADER_SIZE;
+    }
+
+    // Start a new block
+    MemPoolBlock *newBlock = newMemPoolBlock(pool, pool->blockSize);
+    newBlock->next = block;
+    newBlock->used = size;
+    pool->blocks = newBlock;
+    return (char*)newBlock + MEMPOOL_HEADER_SIZE;
+}
+
+const char* MemPoolStrdup(MemPool *pool, const char *string) {
+    if( string == NULL ) {
+        return NULL;
+    }
+    size_t length = strlen(string) + 1;
+    char *result = MemPoolAlloc(pool, length);
+    memcpy(result, string, length);
+    return result;
+}
+
+void DestroyMemPool(MemPool *pool) {
+    MemPoolBlock *block = pool->blocks;
+    while( block != NULL ) {
+        MemPoolBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    pool->blocks = NULL;
+}
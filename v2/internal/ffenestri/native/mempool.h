@@ -0,0 +1,37 @@
+#ifndef MEMPOOL_H
+#define MEMPOOL_H
+
+#include <stdlib.h>
+
+// The default size of each block carved up by a MemPool
+#define MEMPOOL_DEFAULT_BLOCK_SIZE 4096
+
+typedef struct MemPoolBlock {
+    struct MemPoolBlock *next;
+    size_t size;
+    size_t used;
+} MemPoolBlock;
+
+// MemPool is a simple bump allocator. Memory is carved from large blocks
+// and can't be freed individually: everything is released in one go by
+// DestroyMemPool. It is used for memory that shares the lifetime of its
+// owner, such as the per-item bookkeeping of a Menu.
+typedef struct {
+
+    // The list of blocks, most recently allocated first
+    MemPoolBlock *blocks;
+
+    // The size of a standard block
+    size_t blockSize;
+
+    // The number of blocks malloc'd by this pool
+    size_t allocations;
+
+} MemPool;
+
+void InitMemPool(MemPool *pool, size_t blockSize);
+void* MemPoolAlloc(MemPool *pool, size_t size);
+const char* MemPoolStrdup(MemPool *pool, const char *string);
+void DestroyMemPool(MemPool *pool);
+
+#endif //MEMPOOL_H
@@ -0,0 +1,48 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+/*
+#include <stdlib.h>
+#include "mempool.h"
+*/
+import "C"
+
+import "unsafe"
+
+// memPool is a thin wrapper around the native MemPool, allowing the
+// pool logic to be tested and benchmarked from Go
+type memPool struct {
+	pool C.MemPool
+}
+
+func newMemPool(blockSize int) *memPool {
+	result := &memPool{}
+	C.InitMemPool(&result.pool, C.size_t(blockSize))
+	return result
+}
+
+func (m *memPool) alloc(size int) unsafe.Pointer {
+	return C.MemPoolAlloc(&m.pool, C.size_t(size))
+}
+
+func (m *memPool) strdup(str string) unsafe.Pointer {
+	cstr := C.CString(str)
+	defer C.free(unsafe.Pointer(cstr))
+	return unsafe.Pointer(C.MemPoolStrdup(&m.pool, cstr))
+}
+
+// poolString reads back a string allocated by strdup
+func poolString(ptr unsafe.Pointer) string {
+	return C.GoString((*C.char)(ptr))
+}
+
+// allocations returns the number of blocks malloc'd by the pool
+func (m *memPool) allocations() int {
+	return int(m.pool.allocations)
+}
+
+func (m *memPool) destroy() {
+	C.DestroyMemPool(&m.pool)
+}
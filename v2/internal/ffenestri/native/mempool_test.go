@@ -0,0 +1,93 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+import (
+	"fmt"
+	"testing"
+	"unsafe"
+
+	"github.com/matryer/is"
+)
+
+func TestMemPoolAlignment(t *testing.T) {
+	is := is.New(t)
+
+	pool := newMemPool(256)
+	defer pool.destroy()
+
+	align := 2 * unsafe.Sizeof(uintptr(0))
+	for _, size := range []int{1, 3, 8, 17, 33, 0, 100} {
+		ptr := pool.alloc(size)
+		is.True(ptr != nil)
+		is.Equal(uintptr(ptr)%align, uintptr(0))
+	}
+}
+
+func TestMemPoolStrdup(t *testing.T) {
+	is := is.New(t)
+
+	pool := newMemPool(64)
+	defer pool.destroy()
+
+	var ids []string
+	var copies []unsafe.Pointer
+	for i := 0; i < 100; i++ {
+		id := fmt.Sprintf("menuitem-%d", i)
+		ids = append(ids, id)
+		copies = append(copies, pool.strdup(id))
+	}
+
+	// Later allocations must not have clobbered earlier ones
+	for i, id := range ids {
+		is.Equal(poolString(copies[i]), id)
+	}
+}
+
+func TestMemPoolBlocks(t *testing.T) {
+	is := is.New(t)
+
+	pool := newMemPool(1024)
+	defer pool.destroy()
+
+	// Small allocations share a block
+	for i := 0; i < 32; i++ {
+		pool.alloc(16)
+	}
+	is.Equal(pool.allocations(), 1)
+
+	// Oversized allocations get their own block...
+	large := pool.alloc(4096)
+	is.True(large != nil)
+	is.Equal(pool.allocations(), 2)
+
+	// ...without abandoning the current one
+	pool.alloc(16)
+	is.Equal(pool.allocations(), 2)
+
+	// Filling the current block starts a new one
+	for i := 0; i < 64; i++ {
+		pool.alloc(16)
+	}
+	is.Equal(pool.allocations(), 3)
+}
+
+// BenchmarkMemPoolMenu carves the bookkeeping for a 1000 item menu from a
+// pool. Previously, each item cost one malloc for its callback data and
+// one per radio group member list.
+func BenchmarkMemPoolMenu(b *testing.B) {
+	const menuItems = 1000
+	callbackDataSize := int(4 * unsafe.Sizeof(uintptr(0)))
+	mallocs := 0
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		pool := newMemPool(0)
+		for item := 0; item < menuItems; item++ {
+			pool.alloc(callbackDataSize)
+		}
+		mallocs += pool.allocations()
+		pool.destroy()
+	}
+	b.ReportMetric(float64(mallocs)/float64(b.N), "mallocs/op")
+}
@@ -0,0 +1,9 @@
+#ifndef NATIVE_H
+#define NATIVE_H
+
+// The helpers the native units use from ffenestri's common.c. The native
+// package builds its own in standalone.c.
+void ABORT(const char *message, ...);
+char* copyString(const char *string);
+
+#endif //NATIVE_H
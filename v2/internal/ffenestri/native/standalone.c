@@ -0,0 +1,28 @@
+// +build !windows
+
+// ffenestri builds the native units with common.c, which defines these. This
+// file is only built in the native package, so that the units can be built
+// and tested without the rest of ffenestri.
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "native.h"
+
+void ABORT(const char *message, ...) {
+    va_list args;
+    va_start(args, message);
+    fprintf(stderr, "FATAL: ");
+    vfprintf(stderr, message, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    exit(1);
+}
+
+char* copyString(const char *string) {
+    const size_t length = strlen(string);
+    char *result = malloc(length + 1);
+    memcpy(result, string, length + 1);
+    return result;
+}
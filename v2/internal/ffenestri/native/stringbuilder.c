@@ -0,0 +1,180 @@
+// +build !windows
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "native.h"
+#include "stringbuilder.h"
+
+void StringBuilderInit(StringBuilder *sb, size_t capacity) {
+    sb->data = NULL;
+    sb->length = 0;
+    sb->capacity = 0;
+    if( capacity > 0 ) {
+        StringBuilderReserve(sb, capacity);
+    }
+}
+
+// Ensures there is space for `additional` more characters plus the terminator
+void StringBuilderReserve(StringBuilder *sb, size_t additional) {
+    size_t required = sb->length + additional + 1;
+    if( required <= sb->capacity ) {
+        return;
+    }
+    size_t newCapacity = sb->capacity * 2;
+    if( newCapacity < required ) {
+        newCapacity = required;
+    }
+    char *newData = realloc(sb->data, newCapacity);
+    if( newData == NULL ) {
+        ABORT("[StringBuilderReserve] Not enough memory to allocate %zu bytes!", newCapacity);
+    }
+    sb->data = newData;
+    sb->capacity = newCapacity;
+    sb->data[sb->length] = '\0';
+}
+
+void StringBuilderAppendN(StringBuilder *sb, const char *string, size_t length) {
+    StringBuilderReserve(sb, length);
+    memcpy(sb->data + sb->length, string, length);
+    sb->length += length;
+    sb->data[sb->length] = '\0';
+}
+
+void StringBuilderAppend(StringBuilder *sb, const char *string) {
+    StringBuilderAppendN(sb, string, strlen(string));
+}
+
+void StringBuilderAppendv(StringBuilder *sb, const char *format, va_list args) {
+    va_list measure;
+    va_copy(measure, args);
+    // Try to format into the space we already have
+    size_t available = sb->capacity > sb->length ? sb->capacity - sb->length : 0;
+    int needed = vsnprintf(available > 0 ? sb->data + sb->length : NULL, available, format, measure);
+    va_end(measure);
+    if( needed < 0 ) {
+        return;
+    }
+    if( (size_t)needed >= available ) {
+        StringBuilderReserve(sb, (size_t)needed);
+        vsnprintf(sb->data + sb->length, (size_t)needed + 1, format, args);
+    }
+    sb->length += (size_t)needed;
+}
+
+void StringBuilderAppendf(StringBuilder *sb, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    StringBuilderAppendv(sb, format, args);
+    va_end(args);
+}
+
+// The escape sequence for the given character, or NULL if it can be written as is
+static const char* jsonEscape(unsigned char c) {
+    switch (c) {
+        case '"': return "\\\"";
+        case '\\': return "\\\\";
+        case '\b': return "\\b";
+        case '\f': return "\\f";
+        case '\n': return "\\n";
+        case '\r': return "\\r";
+        case '\t': return "\\t";
+        default: return NULL;
+    }
+}
+
+size_t JSONStringLength(const char *string) {
+    size_t result = 2;
+    const unsigned char *s = (const unsigned char*)string;
+    for( ; *s != 0; s++ ) {
+        if( jsonEscape(*s) != NULL ) {
+            result += 2;
+        } else if( *s < 0x20 ) {
+            result += 6;
+        } else {
+            result++;
+        }
+    }
+    return result;
+}
+
+// Appends the string as a quoted JSON string
+void StringBuilderAppendJSONString(StringBuilder *sb, const char *string) {
+    StringBuilderReserve(sb, JSONStringLength(string));
+    char *b = sb->data + sb->length;
+    const unsigned char *s = (const unsigned char*)string;
+    *b++ = '"';
+    for( ; *s != 0; s++ ) {
+        const char *escape = jsonEscape(*s);
+        if( escape != NULL ) {
+            *b++ = escape[0];
+            *b++ = escape[1];
+        } else if( *s < 0x20 ) {
+            b += sprintf(b, "\\u%04x", *s);
+        } else {
+            *b++ = (char)*s;
+        }
+    }
+    *b++ = '"';
+    *b = '\0';
+    sb->length = b - sb->data;
+}
+
+char* StringBuilderTake(StringBuilder *sb) {
+    char *result = sb->data;
+    if( result == NULL ) {
+        result = copyString("");
+    }
+    StringBuilderInit(sb, 0);
+    return result;
+}
+
+void StringBuilderFree(StringBuilder *sb) {
+    free(sb->data);
+    StringBuilderInit(sb, 0);
+}
+
+const char* createCallbackMessage(const char *prefix, const char *callbackID, const char *payload) {
+    size_t prefixLength = strlen(prefix);
+    size_t callbackIDLength = strlen(callbackID);
+    size_t payloadLength = strlen(payload);
+    StringBuilder message;
+    StringBuilderInit(&message, prefixLength + callbackIDLength + 1 + payloadLength);
+    StringBuilderAppendN(&message, prefix, prefixLength);
+    StringBuilderAppendN(&message, callbackID, callbackIDLength);
+    StringBuilderAppendN(&message, "|", 1);
+    StringBuilderAppendN(&message, payload, payloadLength);
+    return StringBuilderTake(&message);
+}
+
+const char* buildMenuClickedMessage(const char *menuItemID, const char *menuType, const char *data, const char *parentID) {
+    if (menuItemID == NULL ) {
+        ABORT("Item ID NULL for menu!!\n");
+    }
+
+    // Size the message up front so it is built with a single allocation
+    size_t length = strlen("MC{\"menuItemID\":,\"menuType\":}") + JSONStringLength(menuItemID) + JSONStringLength(menuType);
+    if (data != NULL) {
+        length += strlen(",\"data\":") + JSONStringLength(data);
+    }
+    if (parentID != NULL) {
+        length += strlen(",\"parentID\":") + JSONStringLength(parentID);
+    }
+
+    StringBuilder message;
+    StringBuilderInit(&message, length);
+    StringBuilderAppend(&message, "MC{\"menuItemID\":");
+    StringBuilderAppendJSONString(&message, menuItemID);
+    StringBuilderAppend(&message, ",\"menuType\":");
+    StringBuilderAppendJSONString(&message, menuType);
+    if (data != NULL) {
+        StringBuilderAppend(&message, ",\"data\":");
+        StringBuilderAppendJSONString(&message, data);
+    }
+    if (parentID != NULL) {
+        StringBuilderAppend(&message, ",\"parentID\":");
+        StringBuilderAppendJSONString(&message, parentID);
+    }
+    StringBuilderAppend(&message, "}");
+    return StringBuilderTake(&message);
+}
@@ -0,0 +1,34 @@
+#ifndef STRINGBUILDER_H
+#define STRINGBUILDER_H
+
+#include <stdarg.h>
+#include <stddef.h>
+
+// StringBuilder is a growable string buffer. Reserve the expected size up front
+// and a string can be built with a single allocation.
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+} StringBuilder;
+
+void StringBuilderInit(StringBuilder *sb, size_t capacity);
+void StringBuilderReserve(StringBuilder *sb, size_t additional);
+void StringBuilderAppend(StringBuilder *sb, const char *string);
+void StringBuilderAppendN(StringBuilder *sb, const char *string, size_t length);
+void StringBuilderAppendf(StringBuilder *sb, const char *format, ...);
+void StringBuilderAppendv(StringBuilder *sb, const char *format, va_list args);
+void StringBuilderAppendJSONString(StringBuilder *sb, const char *string);
+// Returns the built string and resets the builder. The caller owns the string.
+char* StringBuilderTake(StringBuilder *sb);
+void StringBuilderFree(StringBuilder *sb);
+
+// The length of the given string once quoted and escaped as a JSON string
+size_t JSONStringLength(const char *string);
+
+// Creates a "<prefix><callbackID>|<payload>" message for the backend
+const char* createCallbackMessage(const char *prefix, const char *callbackID, const char *payload);
+// Creates a "MC<json>" menu clicked message. data and parentID are optional.
+const char* buildMenuClickedMessage(const char *menuItemID, const char *menuType, const char *data, const char *parentID);
+
+#endif //STRINGBUILDER_H
@@ -0,0 +1,78 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+/*
+#include <stdlib.h>
+#include "stringbuilder.h"
+
+static const char* appendFormatted(StringBuilder *sb, const char *prefix, int value, const char *suffix) {
+    StringBuilderAppendf(sb, "%s%d%s", prefix, value, suffix);
+    return sb->data;
+}
+*/
+import "C"
+
+import "unsafe"
+
+// The wrappers in this file expose the native string building helpers to
+// Go tests and benchmarks
+
+func withCStrings(strs []string, fn func(cstrs []*C.char)) {
+	cstrs := make([]*C.char, len(strs))
+	for i, str := range strs {
+		cstrs[i] = C.CString(str)
+	}
+	fn(cstrs)
+	for _, cstr := range cstrs {
+		C.free(unsafe.Pointer(cstr))
+	}
+}
+
+// optionalCString converts "" to NULL
+func optionalCString(cstr *C.char, str string) *C.char {
+	if str == "" {
+		return nil
+	}
+	return cstr
+}
+
+func buildMenuClickedMessage(menuItemID string, menuType string, data string, parentID string) string {
+	var result string
+	withCStrings([]string{menuItemID, menuType, data, parentID}, func(cstrs []*C.char) {
+		message := C.buildMenuClickedMessage(cstrs[0], cstrs[1], optionalCString(cstrs[2], data), optionalCString(cstrs[3], parentID))
+		result = C.GoString(message)
+		C.free(unsafe.Pointer(message))
+	})
+	return result
+}
+
+func createCallbackMessage(prefix string, callbackID string, payload string) string {
+	var result string
+	withCStrings([]string{prefix, callbackID, payload}, func(cstrs []*C.char) {
+		message := C.createCallbackMessage(cstrs[0], cstrs[1], cstrs[2])
+		result = C.GoString(message)
+		C.free(unsafe.Pointer(message))
+	})
+	return result
+}
+
+// buildString appends each of the given strings, followed by a formatted
+// integer, to a StringBuilder with the given initial capacity
+func buildString(capacity int, strs []string, value int) string {
+	var result string
+	withCStrings(append(strs, "<", ">"), func(cstrs []*C.char) {
+		var sb C.StringBuilder
+		C.StringBuilderInit(&sb, C.size_t(capacity))
+		for _, cstr := range cstrs[:len(strs)] {
+			C.StringBuilderAppend(&sb, cstr)
+		}
+		C.appendFormatted(&sb, cstrs[len(strs)], C.int(value), cstrs[len(strs)+1])
+		taken := C.StringBuilderTake(&sb)
+		result = C.GoString(taken)
+		C.free(unsafe.Pointer(taken))
+		C.StringBuilderFree(&sb)
+	})
+	return result
+}
@@ -0,0 +1,75 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+import (
+	"encoding/json"
+	"strings"
+	"testing"
+
+	"github.com/matryer/is"
+)
+
+func TestStringBuilder(t *testing.T) {
+	is := is.New(t)
+
+	// Growing from empty
+	is.Equal(buildString(0, []string{"a", "bc", ""}, 42), "abc<42>")
+
+	// Growing past the reserved capacity
+	long := strings.Repeat("x", 1000)
+	is.Equal(buildString(8, []string{long, long}, -1), long+long+"<-1>")
+
+	// Nothing appended
+	is.Equal(buildString(16, nil, 0), "<0>")
+}
+
+func TestCreateCallbackMessage(t *testing.T) {
+	is := is.New(t)
+	is.Equal(createCallbackMessage("DM", "123", "OK"), "DM123|OK")
+	is.Equal(createCallbackMessage("SD", "", ""), "SD|")
+}
+
+func TestBuildMenuClickedMessage(t *testing.T) {
+	is := is.New(t)
+
+	tests := []struct {
+		menuItemID string
+		menuType   string
+		data       string
+		parentID   string
+	}{
+		{"1", "ApplicationMenu", "", ""},
+		{"2", "ContextMenu", `{"some":"data"}`, "contextMenu1"},
+		{"3", "TrayMenu", "", "tray"},
+		{`quote"back\slash`, "TrayMenu", "line\nbreak\ttab\x01\x1f", "é😀"},
+	}
+
+	for _, tt := range tests {
+		message := buildMenuClickedMessage(tt.menuItemID, tt.menuType, tt.data, tt.parentID)
+		is.True(strings.HasPrefix(message, "MC"))
+
+		var decoded map[string]string
+		is.NoErr(json.Unmarshal([]byte(message[2:]), &decoded))
+		is.Equal(decoded["menuItemID"], tt.menuItemID)
+		is.Equal(decoded["menuType"], tt.menuType)
+		is.Equal(decoded["data"], tt.data)
+		is.Equal(decoded["parentID"], tt.parentID)
+
+		_, hasData := decoded["data"]
+		is.Equal(hasData, tt.data != "")
+		_, hasParent := decoded["parentID"]
+		is.Equal(hasParent, tt.parentID != "")
+	}
+
+	// Keep the field order of the previous json_encode output
+	is.Equal(buildMenuClickedMessage("id", "TrayMenu", "", "tray"), `MC{"menuItemID":"id","menuType":"TrayMenu","parentID":"tray"}`)
+}
+
+func BenchmarkBuildMenuClickedMessage(b *testing.B) {
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		buildMenuClickedMessage("menuitem-123", "ContextMenu", `{"row":42}`, "contextMenu1")
+	}
+}
@@ -0,0 +1,171 @@
+// +build !windows
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "trace.h"
+
+volatile bool traceEnabled = false;
+
+typedef struct {
+    const char *name;
+    uint64_t timestamp;
+    char phase;
+} traceRecord;
+
+// Each thread records into its own buffer, so recording needs no locks.
+// Buffers are never freed: they are pushed onto a global list when a thread
+// records its first event, and reused by the dump.
+typedef struct TraceBuffer {
+    struct TraceBuffer *next;
+    int threadID;
+    // The number of events ever written. Only the recording thread writes it.
+    atomic_uint_fast64_t count;
+    traceRecord records[TRACE_BUFFER_SIZE];
+} TraceBuffer;
+
+static _Atomic(TraceBuffer*) traceBuffers = NULL;
+static atomic_int nextThreadID = 1;
+static __thread TraceBuffer *threadTraceBuffer = NULL;
+
+// Only one dump at a time
+static pthread_mutex_t traceDumpLock = PTHREAD_MUTEX_INITIALIZER;
+static char *traceFile = NULL;
+
+// The signal handler wakes the dump thread by writing to this pipe
+static int traceSignalPipe[2] = {-1, -1};
+static pthread_t traceDumpThread;
+
+static uint64_t traceNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
+
+static TraceBuffer* newTraceBuffer(void) {
+    TraceBuffer *buffer = calloc(1, sizeof(TraceBuffer));
+    if( buffer == NULL ) {
+        return NULL;
+    }
+    buffer->threadID = atomic_fetch_add(&nextThreadID, 1);
+    TraceBuffer *head = atomic_load(&traceBuffers);
+    do {
+        buffer->next = head;
+    } while( !atomic_compare_exchange_weak(&traceBuffers, &head, buffer) );
+    return buffer;
+}
+
+void traceEvent(const char *name, char phase) {
+    TraceBuffer *buffer = threadTraceBuffer;
+    if( buffer == NULL ) {
+        buffer = threadTraceBuffer = newTraceBuffer();
+        if( buffer == NULL ) {
+            return;
+        }
+    }
+    uint_fast64_t count = atomic_load_explicit(&buffer->count, memory_order_relaxed);
+    traceRecord *record = &buffer->records[count & (TRACE_BUFFER_SIZE - 1)];
+    record->name = name;
+    record->phase = phase;
+    record->timestamp = traceNow();
+    atomic_store_explicit(&buffer->count, count + 1, memory_order_release);
+}
+
+// writeTraceBuffer writes the events of one thread. Events recorded while the
+// dump is running may be skipped.
+static void writeTraceBuffer(FILE *file, TraceBuffer *buffer, bool *first) {
+    uint_fast64_t count = atomic_load_explicit(&buffer->count, memory_order_acquire);
+    uint_fast64_t start = count > TRACE_BUFFER_SIZE ? count - TRACE_BUFFER_SIZE : 0;
+    for( uint_fast64_t i = start; i < count; i++ ) {
+        traceRecord record = buffer->records[i & (TRACE_BUFFER_SIZE - 1)];
+        // Skip anything that has been overwritten since we started
+        if( atomic_load_explicit(&buffer->count, memory_order_acquire) - i > TRACE_BUFFER_SIZE ) {
+            continue;
+        }
+        fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"ffenestri\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":%d,\"tid\":%d}",
+                *first ? "" : ",", record.name, record.phase, (unsigned long long)record.timestamp, (int)getpid(), buffer->threadID);
+        *first = false;
+    }
+}
+
+bool TraceDump(void) {
+    pthread_mutex_lock(&traceDumpLock);
+    if( traceFile == NULL ) {
+        pthread_mutex_unlock(&traceDumpLock);
+        return false;
+    }
+    FILE *file = fopen(traceFile, "w");
+    if( file == NULL ) {
+        pthread_mutex_unlock(&traceDumpLock);
+        return false;
+    }
+    fputs("{\"traceEvents\":[", file);
+    bool first = true;
+    for( TraceBuffer *buffer = atomic_load(&traceBuffers); buffer != NULL; buffer = buffer->next ) {
+        writeTraceBuffer(file, buffer, &first);
+    }
+    fputs("\n]}\n", file);
+    bool result = fclose(file) == 0;
+    pthread_mutex_unlock(&traceDumpLock);
+    return result;
+}
+
+static void traceSignalHandler(int signal) {
+    int savedErrno = errno;
+    char wake = 1;
+    ssize_t ignored = write(traceSignalPipe[1], &wake, 1);
+    (void)ignored;
+    errno = savedErrno;
+}
+
+static void* traceDumpThreadMain(void *unused) {
+    char wake;
+    while( read(traceSignalPipe[0], &wake, 1) > 0 ) {
+        TraceDump();
+    }
+    return NULL;
+}
+
+static void installTraceSignalHandler(void) {
+    if( traceSignalPipe[0] != -1 || pipe(traceSignalPipe) != 0 ) {
+        return;
+    }
+    if( pthread_create(&traceDumpThread, NULL, traceDumpThreadMain, NULL) != 0 ) {
+        return;
+    }
+    pthread_detach(traceDumpThread);
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = traceSignalHandler;
+    // SA_ONSTACK is required to play nicely with the Go runtime
+    action.sa_flags = SA_ONSTACK | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(TRACE_DUMP_SIGNAL, &action, NULL);
+}
+
+void TraceStart(const char *path) {
+    pthread_mutex_lock(&traceDumpLock);
+    free(traceFile);
+    traceFile = strdup(path);
+    pthread_mutex_unlock(&traceDumpLock);
+    traceEnabled = true;
+}
+
+void TraceStop(void) {
+    traceEnabled = false;
+}
+
+void TraceInit(void) {
+    const char *path = getenv(TRACE_ENV_VAR);
+    if( path == NULL || path[0] == '\0' ) {
+        return;
+    }
+    TraceStart(path);
+    installTraceSignalHandler();
+}
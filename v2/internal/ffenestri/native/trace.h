@@ -0,0 +1,37 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The number of events kept per thread. When a thread's buffer is full its
+// oldest events are overwritten. Must be a power of 2.
+#define TRACE_BUFFER_SIZE 8192
+
+// Tracing is enabled by setting this environment variable to the path of the
+// file to write the trace to. The trace is written in Chrome trace-event
+// format when the application is destroyed and whenever the process
+// receives TRACE_DUMP_SIGNAL.
+#define TRACE_ENV_VAR "WAILS_NATIVE_TRACE"
+#define TRACE_DUMP_SIGNAL SIGUSR2
+
+extern volatile bool traceEnabled;
+
+#define TRACE_UNLIKELY(x) __builtin_expect(!!(x), 0)
+
+// TRACE_BEGIN and TRACE_END mark the start and end of a span on the current
+// thread. Names must be string literals (or otherwise never freed).
+#define TRACE_BEGIN(name) do { if (TRACE_UNLIKELY(traceEnabled)) { traceEvent(name, 'B'); } } while (0)
+#define TRACE_END(name) do { if (TRACE_UNLIKELY(traceEnabled)) { traceEvent(name, 'E'); } } while (0)
+
+// TraceInit enables tracing if TRACE_ENV_VAR is set
+void TraceInit(void);
+// TraceStart enables tracing, writing dumps to the given path
+void TraceStart(const char *path);
+void TraceStop(void);
+// TraceDump writes all buffered events to the trace file. Returns false on failure.
+bool TraceDump(void);
+
+void traceEvent(const char *name, char phase);
+
+#endif //TRACE_H
@@ -0,0 +1,43 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+/*
+#include <stdlib.h>
+#include "trace.h"
+
+static void traceTestSpan(int depth) {
+    TRACE_BEGIN("testSpan");
+    if( depth > 0 ) {
+        traceTestSpan(depth - 1);
+    }
+    TRACE_END("testSpan");
+}
+*/
+import "C"
+
+import "unsafe"
+
+// The wrappers in this file expose the native tracer to Go tests
+
+func startTrace(path string) {
+	cpath := C.CString(path)
+	defer C.free(unsafe.Pointer(cpath))
+	C.TraceStart(cpath)
+}
+
+func stopTrace() {
+	C.TraceStop()
+}
+
+func dumpTrace() bool {
+	return bool(C.TraceDump())
+}
+
+// traceTestSpan records `depth` + 1 nested spans on the current thread
+func traceTestSpan(depth int) {
+	C.traceTestSpan(C.int(depth))
+}
+
+const traceBufferSize = int(C.TRACE_BUFFER_SIZE)
@@ -0,0 +1,102 @@
+//go:build !windows
+// +build !windows
+
+package native
+
+import (
+	"encoding/json"
+	"os"
+	"path/filepath"
+	"runtime"
+	"sync"
+	"testing"
+
+	"github.com/matryer/is"
+)
+
+type traceEvent struct {
+	Name      string `json:"name"`
+	Phase     string `json:"ph"`
+	Timestamp uint64 `json:"ts"`
+	ThreadID  int    `json:"tid"`
+}
+
+func readTrace(t *testing.T, path string) []traceEvent {
+	is := is.New(t)
+	data, err := os.ReadFile(path)
+	is.NoErr(err)
+	var trace struct {
+		TraceEvents []traceEvent `json:"traceEvents"`
+	}
+	is.NoErr(json.Unmarshal(data, &trace))
+	return trace.TraceEvents
+}
+
+func TestTraceDump(t *testing.T) {
+	is := is.New(t)
+
+	path := filepath.Join(t.TempDir(), "trace.json")
+	startTrace(path)
+
+	var wg sync.WaitGroup
+	for i := 0; i < 4; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			runtime.LockOSThread()
+			defer runtime.UnlockOSThread()
+			for j := 0; j < 10; j++ {
+				traceTestSpan(2)
+			}
+		}()
+	}
+	wg.Wait()
+	stopTrace()
+	is.True(dumpTrace())
+
+	// Spans must be properly nested per thread, with increasing timestamps
+	depth := map[int]int{}
+	lastTimestamp := map[int]uint64{}
+	for _, event := range readTrace(t, path) {
+		is.Equal(event.Name, "testSpan")
+		is.True(event.Timestamp >= lastTimestamp[event.ThreadID])
+		lastTimestamp[event.ThreadID] = event.Timestamp
+		switch event.Phase {
+		case "B":
+			depth[event.ThreadID]++
+		case "E":
+			depth[event.ThreadID]--
+			is.True(depth[event.ThreadID] >= 0)
+		default:
+			t.Fatalf("unexpected phase %s", event.Phase)
+		}
+	}
+	is.True(len(depth) >= 1)
+	for _, d := range depth {
+		is.Equal(d, 0)
+	}
+}
+
+func TestTraceWrapsAround(t *testing.T) {
+	is := is.New(t)
+
+	path := filepath.Join(t.TempDir(), "trace.json")
+	startTrace(path)
+
+	runtime.LockOSThread()
+	for i := 0; i < traceBufferSize; i++ {
+		traceTestSpan(0)
+	}
+	runtime.UnlockOSThread()
+	stopTrace()
+	is.True(dumpTrace())
+
+	// Each thread keeps at most traceBufferSize events
+	perThread := map[int]int{}
+	for _, event := range readTrace(t, path) {
+		perThread[event.ThreadID]++
+	}
+	for _, count := range perThread {
+		is.True(count <= traceBufferSize)
+	}
+}
@@ -10,7 +10,7 @@ extern Class trayMenuDelegateClass;
 
 // A cache for all our tray menu icons
 // Global because it's a singleton
-struct hashmap_s trayIconCache;
+IconCache trayIconCache;
 
 TrayMenu* NewTrayMenu(const char* menuJSON) {
     TrayMenu* result = malloc(sizeof(TrayMenu));
@@ -105,7 +105,7 @@ void UpdateTrayIcon(TrayMenu *trayMenu) {
         return;
     }
 
-    id trayImage = hashmap_get(&trayIconCache, trayMenu->icon, strlen(trayMenu->icon));
+    id trayImage = IconCacheGetNamed(&trayIconCache, trayMenu->icon);
 
     // If we don't have the image in the icon cache then assume it's base64 encoded image data
     if (trayImage == NULL) {
@@ -224,10 +224,7 @@ void DeleteTrayMenuKeepStatusBarItem(TrayMenu* trayMenu) {
 void LoadTrayIcons() {
 
     // Allocate the Tray Icons
-    if( 0 != hashmap_create((const unsigned)4, &trayIconCache)) {
-        // Couldn't allocate map
-        ABORT("Not enough memory to allocate trayIconCache!");
-    }
+    InitIconCache(&trayIconCache, decodeImage, releaseImage);
 
     unsigned int count = 0;
     while( 1 ) {
@@ -245,22 +242,12 @@ void LoadTrayIcons() {
         }
         int length = atoi((const char *)lengthAsString);
 
-        // Create the icon and add to the hashmap
-        id imageData = ((id(*)(id, SEL, id, int))objc_msgSend)(c("NSData"), s("dataWithBytes:length:"), (id)data, length);
-        id trayImage = ALLOC("NSImage");
-        msg_id(trayImage, s("initWithData:"), imageData);
-        hashmap_put(&trayIconCache, (const char *)name, strlen((const char *)name), trayImage);
+        // Add the icon to the cache. It is decoded when first used.
+        IconCacheAddNamed(&trayIconCache, (const char *)name, data, length, 0);
     }
 }
 
 void UnloadTrayIcons() {
     // Release the tray cache images
-    if( hashmap_num_entries(&trayIconCache) > 0 ) {
-        if (0!=hashmap_iterate_pairs(&trayIconCache, releaseNSObject, NULL)) {
-            ABORT("failed to release hashmap entries!");
-        }
-    }
-
-    //Free radio groups hashmap
-    hashmap_destroy(&trayIconCache);
+    DestroyIconCache(&trayIconCache);
 }
\ No newline at end of file
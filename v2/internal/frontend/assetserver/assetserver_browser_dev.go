@@ -22,9 +22,9 @@ It injects a websocket based IPC script into `index.html`.
 */
 
 type BrowserAssetServer struct {
-	assets    fs.FS
-	runtimeJS []byte
-	logger    *logger.Logger
+	assets  fs.FS
+	runtime *RuntimeBundle
+	logger  *logger.Logger
 }
 
 func NewBrowserAssetServer(ctx context.Context, assets fs.FS, bindingsJSON string) (*BrowserAssetServer, error) {
@@ -40,10 +40,8 @@ func NewBrowserAssetServer(ctx context.Context, assets fs.FS, bindingsJSON strin
 		return nil, err
 	}
 
-	var buffer bytes.Buffer
-	buffer.WriteString(`window.wailsbindings='` + bindingsJSON + `';` + "\n")
-	buffer.Write(runtime.RuntimeDesktopJS)
-	result.runtimeJS = buffer.Bytes()
+	compactIPC, _ := ctx.Value("compactipc").(bool)
+	result.runtime = NewRuntimeBundle(bindingsJSON, compactIPC)
 
 	return result, nil
 }
@@ -80,7 +78,7 @@ func (a *BrowserAssetServer) processIndexHTML() ([]byte, error) {
 	}
 
 	if wailsOptions.disableRuntimeInjection == false {
-		err := insertScriptInHead(htmlNode, "/wails/runtime.js")
+		err := insertScriptInHead(htmlNode, a.runtime.Path())
 		if err != nil {
 			return nil, err
 		}
@@ -100,8 +98,8 @@ func (a *BrowserAssetServer) Load(filename string) ([]byte, string, error) {
 	switch filename {
 	case "/":
 		content, err = a.processIndexHTML()
-	case "/wails/runtime.js":
-		content = a.runtimeJS
+	case a.runtime.Path(), runtimePath:
+		content = a.runtime.Script
 	case "/wails/ipc.js":
 		content = runtime.WebsocketIPC
 	default:
@@ -115,3 +113,9 @@ func (a *BrowserAssetServer) Load(filename string) ([]byte, string, error) {
 	mimeType := GetMimetype(filename, content)
 	return content, mimeType, nil
 }
+
+// CacheHeaders returns the caching headers to serve the given file from Load
+// with. The result must not be modified.
+func (a *BrowserAssetServer) CacheHeaders(filename string) map[string]string {
+	return a.runtime.cacheHeaders(filename)
+}
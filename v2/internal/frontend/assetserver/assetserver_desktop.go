@@ -1,7 +1,6 @@
 package assetserver
 
 import (
-	"bytes"
 	"context"
 	"io/fs"
 	"log"
@@ -12,9 +11,9 @@ import (
 )
 
 type DesktopAssetServer struct {
-	assets    fs.FS
-	runtimeJS []byte
-	logger    *logger.Logger
+	assets  fs.FS
+	runtime *RuntimeBundle
+	logger  *logger.Logger
 }
 
 func NewDesktopAssetServer(ctx context.Context, assets fs.FS, bindingsJSON string) (*DesktopAssetServer, error) {
@@ -31,10 +30,8 @@ func NewDesktopAssetServer(ctx context.Context, assets fs.FS, bindingsJSON strin
 		return nil, err
 	}
 
-	var buffer bytes.Buffer
-	buffer.WriteString(`window.wailsbindings='` + bindingsJSON + `';` + "\n")
-	buffer.Write(runtime.RuntimeDesktopJS)
-	result.runtimeJS = buffer.Bytes()
+	compactIPC, _ := ctx.Value("compactipc").(bool)
+	result.runtime = NewRuntimeBundle(bindingsJSON, compactIPC)
 
 	return result, nil
 }
@@ -56,7 +53,7 @@ func (a *DesktopAssetServer) processIndexHTML() ([]byte, error) {
 		return nil, err
 	}
 	if wailsOptions.disableRuntimeInjection == false {
-		indexHTML, err = injectHTML(string(indexHTML), `<script src="/wails/runtime.js"></script>`)
+		indexHTML, err = injectHTML(string(indexHTML), `<script src="`+a.runtime.Path()+`"></script>`)
 		if err != nil {
 			return nil, err
 		}
@@ -77,8 +74,8 @@ func (a *DesktopAssetServer) Load(filename string) ([]byte, string, error) {
 	switch filename {
 	case "/":
 		content, err = a.processIndexHTML()
-	case "/wails/runtime.js":
-		content = a.runtimeJS
+	case a.runtime.Path(), runtimePath:
+		content = a.runtime.Script
 	case "/wails/ipc.js":
 		content = runtime.DesktopIPC
 	default:
@@ -92,3 +89,9 @@ func (a *DesktopAssetServer) Load(filename string) ([]byte, string, error) {
 	mimeType := GetMimetype(filename, content)
 	return content, mimeType, nil
 }
+
+// CacheHeaders returns the caching headers to serve the given file from Load
+// with. The result must not be modified.
+func (a *DesktopAssetServer) CacheHeaders(filename string) map[string]string {
+	return a.runtime.cacheHeaders(filename)
+}
@@ -0,0 +1,92 @@
+package assetserver
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"sync"
+
+	"github.com/wailsapp/wails/v2/internal/frontend/runtime"
+)
+
+// runtimePath is where the runtime is served when a page asks for it by name.
+// The asset servers inject the bundle's Path, which changes with its content.
+const runtimePath = "/wails/runtime.js"
+
+// immutableCacheControl lets a webview keep the bundle for as long as it likes
+const immutableCacheControl = "public, max-age=31536000, immutable"
+
+// RuntimeBundle is the runtime script with the app's bindings. The bindings
+// don't change while the app runs, so the bundle is made once and shared by
+// every asset server. Script must not be modified.
+type RuntimeBundle struct {
+	Script []byte
+
+	// Hash identifies the content of Script
+	Hash string
+
+	path    string
+	headers map[string]string
+}
+
+// The bundle made last, which the next asset server reuses if its bindings
+// are the same
+var lastBundle struct {
+	lock         sync.Mutex
+	bindingsJSON string
+	compactIPC   bool
+	bundle       *RuntimeBundle
+}
+
+// NewRuntimeBundle returns the runtime bundle for the given bindings
+func NewRuntimeBundle(bindingsJSON string, compactIPC bool) *RuntimeBundle {
+	lastBundle.lock.Lock()
+	defer lastBundle.lock.Unlock()
+	if lastBundle.bundle != nil && lastBundle.bindingsJSON == bindingsJSON && lastBundle.compactIPC == compactIPC {
+		return lastBundle.bundle
+	}
+
+	const bindingsPrefix = `window.wailsbindings='`
+	const bindingsSuffix = `';` + "\n"
+	const compactHeader = `window.wailsipc={compact:true};` + "\n"
+	script := make([]byte, 0, len(bindingsPrefix)+len(bindingsJSON)+len(bindingsSuffix)+len(compactHeader)+len(runtime.RuntimeDesktopJS))
+	script = append(script, bindingsPrefix...)
+	script = append(script, bindingsJSON...)
+	script = append(script, bindingsSuffix...)
+	if compactIPC {
+		// Tells the runtime it can send compact frames, see dispatcher/frames.go
+		script = append(script, compactHeader...)
+	}
+	script = append(script, runtime.RuntimeDesktopJS...)
+
+	sum := sha256.Sum256(script)
+	hash := hex.EncodeToString(sum[:8])
+	result := &RuntimeBundle{
+		Script: script,
+		Hash:   hash,
+		path:   "/wails/runtime." + hash + ".js",
+		headers: map[string]string{
+			"Cache-Control": immutableCacheControl,
+			"ETag":          `"` + hash + `"`,
+		},
+	}
+
+	lastBundle.bindingsJSON = bindingsJSON
+	lastBundle.compactIPC = compactIPC
+	lastBundle.bundle = result
+	return result
+}
+
+// Path is the path the bundle is injected into pages with. It changes with
+// the content, so the bundle can be cached forever.
+func (r *RuntimeBundle) Path() string {
+	return r.path
+}
+
+// cacheHeaders returns the caching headers to serve the given file with. The
+// result must not be modified.
+func (r *RuntimeBundle) cacheHeaders(filename string) map[string]string {
+	if filename != r.path {
+		return nil
+	}
+	return r.headers
+}
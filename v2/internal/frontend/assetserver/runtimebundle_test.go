@@ -0,0 +1,86 @@
+package assetserver
+
+import (
+	"bytes"
+	"context"
+	"strings"
+	"testing"
+
+	"github.com/wailsapp/wails/v2/internal/binding"
+	"github.com/wailsapp/wails/v2/internal/frontend/assetserver/testdata"
+	"github.com/wailsapp/wails/v2/internal/logger"
+)
+
+func TestRuntimeBundle(t *testing.T) {
+	first := NewRuntimeBundle(`{"main":{}}`, false)
+	if second := NewRuntimeBundle(`{"main":{}}`, false); second != first {
+		t.Error("expected the bundle to be shared")
+	}
+	if !bytes.HasPrefix(first.Script, []byte(`window.wailsbindings='{"main":{}}';`)) {
+		t.Errorf("unexpected script: %.50s", first.Script)
+	}
+	other := NewRuntimeBundle(`{"other":{}}`, false)
+	if other.Hash == first.Hash || other.Path() == first.Path() {
+		t.Error("expected different bindings to have a different hash")
+	}
+
+	server, err := NewDesktopAssetServer(context.Background(), testdata.TopLevelFS, `{"main":{}}`)
+	if err != nil {
+		t.Fatal(err)
+	}
+	index, _, err := server.Load("/")
+	if err != nil {
+		t.Fatal(err)
+	}
+	if !strings.Contains(string(index), `<script src="`+server.runtime.Path()+`"></script>`) {
+		t.Errorf("expected the bundle's path in index.html, got %s", index)
+	}
+	for _, path := range []string{server.runtime.Path(), runtimePath} {
+		content, _, err := server.Load(path)
+		if err != nil {
+			t.Fatal(err)
+		}
+		if !bytes.Equal(content, server.runtime.Script) {
+			t.Errorf("expected %s to serve the bundle", path)
+		}
+	}
+	if headers := server.CacheHeaders(server.runtime.Path()); headers["Cache-Control"] != immutableCacheControl || headers["ETag"] != `"`+server.runtime.Hash+`"` {
+		t.Errorf("unexpected headers for the bundle: %v", headers)
+	}
+	if headers := server.CacheHeaders(runtimePath); headers != nil {
+		t.Errorf("expected %s to be served without caching headers, got %v", runtimePath, headers)
+	}
+}
+
+type StartupApp struct{}
+
+func (s *StartupApp) Greet(name string) string        { return "Hello " + name }
+func (s *StartupApp) Add(a int, b int) int            { return a + b }
+func (s *StartupApp) Lookup(keys []string) []string   { return keys }
+func (s *StartupApp) Settings() map[string]string     { return nil }
+func (s *StartupApp) SetSettings(map[string]string)   {}
+func (s *StartupApp) Upload(data []byte, path string) {}
+
+// BenchmarkStartupAssets makes the bindings JSON and runtime bundle for a dev
+// session, where the desktop frontend and the dev server each start an asset
+// server
+func BenchmarkStartupAssets(b *testing.B) {
+	log := logger.New(nil)
+	ctx := context.WithValue(context.Background(), "logger", log)
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		// Start from scratch, as a new process does
+		lastBundle.bundle = nil
+		bindings := binding.NewBindings(log, []interface{}{&StartupApp{}}, nil)
+		for frontend := 0; frontend < 2; frontend++ {
+			bindingsJSON, err := bindings.ToJSON()
+			if err != nil {
+				b.Fatal(err)
+			}
+			_, err = NewDesktopAssetServer(ctx, testdata.TopLevelFS, bindingsJSON)
+			if err != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+}
@@ -0,0 +1,84 @@
+package common
+
+import (
+	"crypto/rand"
+	"encoding/hex"
+	"os"
+	"strings"
+	"sync"
+	"time"
+)
+
+// BufferPath is the path on the wails scheme that published buffers are
+// served from. The token follows it.
+const BufferPath = "/wails/buffer/"
+
+// bufferExpiry is how long a published buffer waits to be fetched
+const bufferExpiry = time.Minute
+
+// BufferStore holds buffers published for the frontend to fetch. Each buffer
+// can be fetched once.
+type BufferStore struct {
+	lock    sync.Mutex
+	buffers map[string]*publishedBuffer
+	expiry  time.Duration
+}
+
+type publishedBuffer struct {
+	data  []byte
+	timer *time.Timer
+}
+
+// Buffers is the store served by the desktop frontends
+var Buffers = NewBufferStore()
+
+func NewBufferStore() *BufferStore {
+	return &BufferStore{
+		buffers: make(map[string]*publishedBuffer),
+		expiry:  bufferExpiry,
+	}
+}
+
+// Publish stores data under a new random token and returns the token. data is
+// not copied so must not be modified until it has been taken.
+func (s *BufferStore) Publish(data []byte) string {
+	var random [16]byte
+	if _, err := rand.Read(random[:]); err != nil {
+		panic(err)
+	}
+	token := hex.EncodeToString(random[:])
+
+	s.lock.Lock()
+	s.buffers[token] = &publishedBuffer{
+		data: data,
+		timer: time.AfterFunc(s.expiry, func() {
+			s.Take(token)
+		}),
+	}
+	s.lock.Unlock()
+	return token
+}
+
+// Take removes the buffer with the given token from the store and returns it
+func (s *BufferStore) Take(token string) ([]byte, bool) {
+	s.lock.Lock()
+	defer s.lock.Unlock()
+	buffer, ok := s.buffers[token]
+	if !ok {
+		return nil, false
+	}
+	delete(s.buffers, token)
+	buffer.timer.Stop()
+	return buffer.data, true
+}
+
+// Load takes the buffer published under the path file, which starts with
+// BufferPath, and returns it with its mime type, like an asset store. It
+// returns os.ErrNotExist if there is no such buffer.
+func (s *BufferStore) Load(file string) ([]byte, string, error) {
+	data, ok := s.Take(strings.TrimPrefix(file, BufferPath))
+	if !ok {
+		return nil, "", os.ErrNotExist
+	}
+	return data, "application/octet-stream", nil
+}
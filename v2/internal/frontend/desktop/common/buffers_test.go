@@ -0,0 +1,103 @@
+package common
+
+import (
+	"bytes"
+	"encoding/json"
+	"os"
+	"strconv"
+	"testing"
+	"time"
+)
+
+func TestBufferStore(t *testing.T) {
+	store := NewBufferStore()
+	data := []byte("some data")
+	token := store.Publish(data)
+	if len(token) != 32 {
+		t.Fatalf("unexpected token %q", token)
+	}
+	if other := store.Publish(data); other == token {
+		t.Fatal("tokens must be unique")
+	}
+
+	result, ok := store.Take(token)
+	if !ok || !bytes.Equal(result, data) {
+		t.Fatalf("expected %q, got %q (%t)", data, result, ok)
+	}
+	if _, ok := store.Take(token); ok {
+		t.Fatal("a buffer can only be taken once")
+	}
+	if _, ok := store.Take("unknown"); ok {
+		t.Fatal("unknown token returned a buffer")
+	}
+}
+
+func TestBufferStoreLoad(t *testing.T) {
+	store := NewBufferStore()
+	data := []byte("some data")
+	file := BufferPath + store.Publish(data)
+
+	result, mimeType, err := store.Load(file)
+	if err != nil || !bytes.Equal(result, data) || mimeType != "application/octet-stream" {
+		t.Fatalf("expected %q, got %q %q (%v)", data, result, mimeType, err)
+	}
+	if _, _, err := store.Load(file); !os.IsNotExist(err) {
+		t.Fatalf("expected a fetched buffer not to exist, got %v", err)
+	}
+}
+
+func TestBufferStoreExpiry(t *testing.T) {
+	store := NewBufferStore()
+	store.expiry = 10 * time.Millisecond
+	token := store.Publish([]byte("data"))
+	time.Sleep(100 * time.Millisecond)
+	if _, ok := store.Take(token); ok {
+		t.Fatal("expected the buffer to have expired")
+	}
+}
+
+// BenchmarkTransfer100MB compares the Go side cost of sending 100MB to the
+// page as a call result, which is JSON (base64) encoded, quoted into a
+// script and copied into a C string, against publishing it as a buffer,
+// which is copied once into C memory. The page side JSON.parse and base64
+// decode of the callback path are not included.
+func BenchmarkTransfer100MB(b *testing.B) {
+	data := make([]byte, 100*1024*1024)
+	for i := range data {
+		data[i] = byte(i * 7)
+	}
+
+	b.Run("callback", func(b *testing.B) {
+		b.SetBytes(int64(len(data)))
+		var sent int
+		for i := 0; i < b.N; i++ {
+			message, err := json.Marshal(struct {
+				Result     interface{} `json:"result"`
+				Err        string      `json:"error"`
+				CallbackID string      `json:"callbackid"`
+			}{Result: data, CallbackID: "main.App.Load-1"})
+			if err != nil {
+				b.Fatal(err)
+			}
+			script := `window.wails.Callback(` + strconv.Quote(string(message)) + `);`
+			cString := make([]byte, len(script)+1)
+			copy(cString, script)
+			sent = len(cString)
+		}
+		b.ReportMetric(float64(sent), "bytes/transfer")
+	})
+
+	b.Run("buffer", func(b *testing.B) {
+		store := NewBufferStore()
+		b.SetBytes(int64(len(data)))
+		var sent int
+		for i := 0; i < b.N; i++ {
+			token := store.Publish(data)
+			buffer, _ := store.Take(token)
+			cBytes := make([]byte, len(buffer))
+			copy(cBytes, buffer)
+			sent = len(cBytes)
+		}
+		b.ReportMetric(float64(sent), "bytes/transfer")
+	})
+}
@@ -0,0 +1,9 @@
+package common
+
+// IsEventSubscription returns true for the messages sent when the page starts
+// ("EO") and stops ("EX") listening for an event. Frontends process them
+// before returning to the message loop, so a subscription is recorded before
+// any call the page makes after it.
+func IsEventSubscription(message string) bool {
+	return len(message) > 2 && message[0] == 'E' && (message[1] == 'O' || message[1] == 'X')
+}
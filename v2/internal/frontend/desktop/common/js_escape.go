@@ -0,0 +1,115 @@
+package common
+
+import "strings"
+
+// EscapeJSString escapes s so it can be placed between single or double
+// quotes in a JavaScript string literal that is evaluated in the webview.
+// Control characters, quotes, backslashes and angle brackets are written as
+// \xNN, U+2028 and U+2029 as \u2028 and \u2029. Everything else, including
+// other UTF-8 sequences, is copied through untouched, so the decoded string
+// is identical to s. The output matches webview_js_encode in the v1 webview.
+//
+// Input is scanned eight bytes at a time and only the bytes around a match
+// are inspected individually. When nothing needs escaping s is returned as is.
+func EscapeJSString(s string) string {
+	i := nextJSEscape(s, 0)
+	if i == len(s) {
+		return s
+	}
+
+	var result strings.Builder
+	result.Grow(len(s) + len(s)/8 + 16)
+	last := 0
+	for i < len(s) {
+		c := s[i]
+		if c == 0xE2 {
+			// Only the line and paragraph separators are escaped
+			if i+2 < len(s) && s[i+1] == 0x80 && (s[i+2] == 0xA8 || s[i+2] == 0xA9) {
+				result.WriteString(s[last:i])
+				if s[i+2] == 0xA8 {
+					result.WriteString(`\u2028`)
+				} else {
+					result.WriteString(`\u2029`)
+				}
+				i += 3
+				last = i
+			} else {
+				i++
+			}
+		} else {
+			result.WriteString(s[last:i])
+			result.WriteString(`\x`)
+			result.WriteByte(jsHex[c>>4])
+			result.WriteByte(jsHex[c&0x0f])
+			i++
+			last = i
+		}
+		i = nextJSEscape(s, i)
+	}
+	result.WriteString(s[last:])
+	return result.String()
+}
+
+const jsHex = "0123456789abcdef"
+
+// jsEscapeCandidate holds the bytes that may need escaping. 0xE2 is the lead
+// byte of U+2028 and U+2029 and is confirmed by the caller.
+var jsEscapeCandidate = func() (table [256]bool) {
+	for c := 0; c < 0x20; c++ {
+		table[c] = true
+	}
+	for _, c := range []byte{'"', '\'', '\\', '<', '>', 0xE2} {
+		table[c] = true
+	}
+	return
+}()
+
+const (
+	swarOnes  = 0x0101010101010101
+	swarHighs = 0x8080808080808080
+)
+
+// swarHasZero reports whether any byte of x is zero
+func swarHasZero(x uint64) bool {
+	return (x-swarOnes)&^x&swarHighs != 0
+}
+
+// swarHasByte reports whether any byte of x equals c
+func swarHasByte(x uint64, c byte) bool {
+	return swarHasZero(x ^ (swarOnes * uint64(c)))
+}
+
+// swarHasLess reports whether any byte of x is less than n (n <= 128)
+func swarHasLess(x uint64, n byte) bool {
+	return (x-swarOnes*uint64(n))&^x&swarHighs != 0
+}
+
+// load64 reads s[i:i+8] as a little endian word. The compiler merges the
+// byte loads into a single load.
+func load64(s string, i int) uint64 {
+	_ = s[i+7]
+	return uint64(s[i]) | uint64(s[i+1])<<8 | uint64(s[i+2])<<16 | uint64(s[i+3])<<24 |
+		uint64(s[i+4])<<32 | uint64(s[i+5])<<40 | uint64(s[i+6])<<48 | uint64(s[i+7])<<56
+}
+
+// nextJSEscape returns the index of the next candidate byte at or after i,
+// or len(s) if there is none
+func nextJSEscape(s string, i int) int {
+	for ; i+8 <= len(s); i += 8 {
+		x := load64(s, i)
+		if swarHasLess(x, 0x20) || swarHasByte(x, '"') || swarHasByte(x, '\'') ||
+			swarHasByte(x, '\\') || swarHasByte(x, '<') || swarHasByte(x, '>') ||
+			swarHasByte(x, 0xE2) {
+			// The tests are exact, so the candidate is within this word
+			for ; !jsEscapeCandidate[s[i]]; i++ {
+			}
+			return i
+		}
+	}
+	for ; i < len(s); i++ {
+		if jsEscapeCandidate[s[i]] {
+			return i
+		}
+	}
+	return i
+}
@@ -0,0 +1,36 @@
+//go:build go1.18
+// +build go1.18
+
+package common
+
+import (
+	"testing"
+	"text/template"
+	"unicode"
+	"unicode/utf8"
+)
+
+func FuzzEscapeJSString(f *testing.F) {
+	for _, seed := range []string{"", "plain", `'"\<>`, "\u2028\u2029", "\xe2\x80\xa8", "héllo\n世界", "\xff\xfe"} {
+		f.Add(seed)
+	}
+	f.Fuzz(func(t *testing.T, input string) {
+		escaped := EscapeJSString(input)
+		checkEscaped(t, input, escaped)
+
+		// template.JSEscapeString writes non-printable runes outside the
+		// BMP as \u with five digits, which JavaScript does not accept,
+		// and replaces invalid UTF-8, so only compare where it is exact
+		if !utf8.ValidString(input) {
+			return
+		}
+		for _, r := range input {
+			if r > 0xFFFF && !unicode.IsPrint(r) {
+				return
+			}
+		}
+		if theirs := decodeJSString(t, template.JSEscapeString(input)); theirs != input {
+			t.Fatalf("template.JSEscapeString(%q) decoded to %q", input, theirs)
+		}
+	})
+}
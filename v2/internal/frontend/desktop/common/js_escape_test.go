@@ -0,0 +1,159 @@
+package common
+
+import (
+	"encoding/json"
+	"strconv"
+	"strings"
+	"testing"
+	"text/template"
+	"unicode/utf8"
+)
+
+// decodeJSString decodes the body of a JavaScript string literal, as the
+// browser would. Raw bytes are copied through so invalid UTF-8 round trips.
+func decodeJSString(t testing.TB, s string) string {
+	var result strings.Builder
+	for i := 0; i < len(s); i++ {
+		c := s[i]
+		if c != '\\' {
+			result.WriteByte(c)
+			continue
+		}
+		i++
+		if i == len(s) {
+			t.Fatalf("dangling backslash in %q", s)
+		}
+		switch s[i] {
+		case 'x':
+			v, err := strconv.ParseUint(s[i+1:i+3], 16, 8)
+			if err != nil {
+				t.Fatalf("bad \\x escape in %q", s)
+			}
+			result.WriteRune(rune(v))
+			i += 2
+		case 'u':
+			v, err := strconv.ParseUint(s[i+1:i+5], 16, 16)
+			if err != nil {
+				t.Fatalf("bad \\u escape in %q", s)
+			}
+			result.WriteRune(rune(v))
+			i += 4
+		case 'n':
+			result.WriteByte('\n')
+		case 'r':
+			result.WriteByte('\r')
+		case 't':
+			result.WriteByte('\t')
+		default:
+			result.WriteByte(s[i])
+		}
+	}
+	return result.String()
+}
+
+// checkEscaped verifies that escaped is safe to place in a quoted literal
+// and decodes back to input
+func checkEscaped(t testing.TB, input, escaped string) {
+	for i := 0; i < len(escaped); i++ {
+		switch c := escaped[i]; {
+		case c < 0x20, c == '"', c == '\'', c == '<', c == '>':
+			t.Fatalf("unescaped %q at %d in %q", c, i, escaped)
+		case c == '\\':
+			i++
+		}
+	}
+	if strings.Contains(escaped, "\u2028") || strings.Contains(escaped, "\u2029") {
+		t.Fatalf("unescaped line separator in %q", escaped)
+	}
+	if decoded := decodeJSString(t, escaped); decoded != input {
+		t.Fatalf("%q decoded to %q, expected %q", escaped, decoded, input)
+	}
+}
+
+func TestEscapeJSString(t *testing.T) {
+	tests := []struct {
+		input string
+		want  string
+	}{
+		{"", ""},
+		{"plain text", "plain text"},
+		{"it's", `it\x27s`},
+		{`say "hi"`, `say \x22hi\x22`},
+		{`C:\path`, `C:\x5cpath`},
+		{"</script>", `\x3c/script\x3e`},
+		{"line\nbreak\r\ttab\x00", `line\x0abreak\x0d\x09tab\x00`},
+		{"sep\u2028para\u2029", `sep\u2028para\u2029`},
+		{"héllo → 世界 \u2027\u202a", "héllo → 世界 \u2027\u202a"},
+		{"\xe2\x80", "\xe2\x80"},
+		{"0123456789abcdef'0123456789abcdef", `0123456789abcdef\x270123456789abcdef`},
+	}
+	for _, tt := range tests {
+		got := EscapeJSString(tt.input)
+		if got != tt.want {
+			t.Errorf("EscapeJSString(%q) = %q, want %q", tt.input, got, tt.want)
+		}
+		checkEscaped(t, tt.input, got)
+	}
+}
+
+func TestEscapeJSStringEveryByte(t *testing.T) {
+	// Place each byte at every offset within a word to exercise the
+	// word-at-a-time scan
+	for c := 0; c < 256; c++ {
+		for offset := 0; offset < 16; offset++ {
+			input := strings.Repeat("a", offset) + string([]byte{byte(c)}) + strings.Repeat("b", 16)
+			escaped := EscapeJSString(input)
+			checkEscaped(t, input, escaped)
+			if jsEscapeCandidate[c] && c != 0xE2 && escaped == input {
+				t.Fatalf("byte %#x at offset %d was not escaped", c, offset)
+			}
+		}
+	}
+}
+
+func TestEscapeJSStringMatchesTemplate(t *testing.T) {
+	// The output differs from template.JSEscapeString but must decode to
+	// the same string for the payloads Notify sends
+	payload, _ := json.Marshal(map[string]interface{}{
+		"name": `it's <b>"quoted"</b> & a\b`,
+		"data": []interface{}{"\u2028", "日本", 1.5, nil, "\x01"},
+	})
+	input := string(payload)
+	if !utf8.ValidString(input) {
+		t.Fatal("payload is not valid UTF-8")
+	}
+	ours := decodeJSString(t, EscapeJSString(input))
+	theirs := decodeJSString(t, template.JSEscapeString(input))
+	if ours != theirs || ours != input {
+		t.Fatalf("decoded outputs differ:\n%q\n%q", ours, theirs)
+	}
+}
+
+func benchmarkPayload() string {
+	data := make([]string, 0, 16384)
+	for len(data) < cap(data) {
+		data = append(data, `user's "item" <42> with unicode 世界 and plain ascii text`)
+	}
+	payload, _ := json.Marshal(map[string]interface{}{"name": "bench", "data": data})
+	return string(payload[:1<<20])
+}
+
+func BenchmarkEscapeJSString(b *testing.B) {
+	payload := benchmarkPayload()
+	b.SetBytes(int64(len(payload)))
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		EscapeJSString(payload)
+	}
+}
+
+func BenchmarkTemplateJSEscapeString(b *testing.B) {
+	payload := benchmarkPayload()
+	b.SetBytes(int64(len(payload)))
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		template.JSEscapeString(payload)
+	}
+}
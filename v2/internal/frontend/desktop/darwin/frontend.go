@@ -17,10 +17,10 @@ import (
 	"context"
 	"encoding/json"
 	"fmt"
-	"html/template"
 	"log"
 	"os"
 	"strconv"
+	"strings"
 	"unsafe"
 
 	"github.com/wailsapp/wails/v2/internal/binding"
@@ -227,7 +227,7 @@ func (f *Frontend) Notify(name string, data ...interface{}) {
 		f.logger.Error(err.Error())
 		return
 	}
-	f.ExecJS(`window.wails.EventsNotify('` + template.JSEscapeString(string(payload)) + `');`)
+	f.ExecJS(`window.wails.EventsNotify('` + common.EscapeJSString(string(payload)) + `');`)
 }
 
 func (f *Frontend) processMessage(message string) {
@@ -244,6 +244,13 @@ func (f *Frontend) processMessage(message string) {
 	//	return
 	//}
 
+	if common.IsEventSubscription(message) {
+		if _, err := f.dispatcher.ProcessMessage(message, f); err != nil {
+			f.logger.Error(err.Error())
+		}
+		return
+	}
+
 	go func() {
 		result, err := f.dispatcher.ProcessMessage(message, f)
 		if err != nil {
@@ -288,8 +295,13 @@ func (f *Frontend) processRequest(r *request) {
 			panic("Unexpected host for request on wails:// scheme")
 		}
 
-		// Load file from asset store
-		_contents, _mimetype, err = f.assets.Load(file)
+		if strings.HasPrefix(file, common.BufferPath) {
+			// Published buffers are served as they are
+			_contents, _mimetype, err = common.Buffers.Load(file)
+		} else {
+			// Load file from asset store
+			_contents, _mimetype, err = f.assets.Load(file)
+		}
 	}
 
 	statusCode := 200
@@ -304,7 +316,7 @@ func (f *Frontend) processRequest(r *request) {
 	}
 
 	var data unsafe.Pointer
-	if _contents != nil {
+	if len(_contents) > 0 {
 		data = unsafe.Pointer(&_contents[0])
 	}
 	mimetype := C.CString(_mimetype)
@@ -18,7 +18,7 @@ import (
 	"log"
 	"os"
 	"strconv"
-	"text/template"
+	"strings"
 	"unsafe"
 
 	"github.com/wailsapp/wails/v2/internal/binding"
@@ -219,7 +219,7 @@ func (f *Frontend) Notify(name string, data ...interface{}) {
 		f.logger.Error(err.Error())
 		return
 	}
-	f.mainWindow.ExecJS(`window.wails.EventsNotify('` + template.JSEscapeString(string(payload)) + `');`)
+	f.mainWindow.ExecJS(`window.wails.EventsNotify('` + common.EscapeJSString(string(payload)) + `');`)
 }
 
 func (f *Frontend) processMessage(message string) {
@@ -230,6 +230,13 @@ func (f *Frontend) processMessage(message string) {
 		return
 	}
 
+	if common.IsEventSubscription(message) {
+		if _, err := f.dispatcher.ProcessMessage(message, f); err != nil {
+			f.logger.Error(err.Error())
+		}
+		return
+	}
+
 	go func() {
 		result, err := f.dispatcher.ProcessMessage(message, f)
 		if err != nil {
@@ -304,24 +311,22 @@ func (f *Frontend) processRequest(request unsafe.Pointer) {
 		}
 	}
 
+	// Published buffers are served as they are
+	if strings.HasPrefix(file, common.BufferPath) {
+		f.processBufferRequest(req, strings.TrimPrefix(file, common.BufferPath))
+		return
+	}
+
 	// Load file from asset store
 	content, mimeType, err := f.assets.Load(file)
 
 	// TODO How to return 404/500 errors to webkit?
 	if err != nil {
 		if os.IsNotExist(err) {
-			message := C.CString("File not found")
-			gerr := C.g_error_new_literal(C.g_quark_from_string(message), C.int(404), message)
-			C.webkit_uri_scheme_request_finish_error(req, gerr)
-			C.g_error_free(gerr)
-			C.free(unsafe.Pointer(message))
+			finishRequestWithError(req, 404, "File not found")
 		} else {
 			err = fmt.Errorf("Error processing request %s: %v", uri, err)
-			message := C.CString("Internal Error")
-			gerr := C.g_error_new_literal(C.g_quark_from_string(message), C.int(500), message)
-			C.webkit_uri_scheme_request_finish_error(req, gerr)
-			C.g_error_free(gerr)
-			C.free(unsafe.Pointer(message))
+			finishRequestWithError(req, 500, "Internal Error")
 		}
 		return
 	}
@@ -338,3 +343,27 @@ func (f *Frontend) processRequest(request unsafe.Pointer) {
 	C.webkit_uri_scheme_request_finish(req, stream, cLen, cMimeType)
 	C.g_object_unref(C.gpointer(stream))
 }
+
+// processBufferRequest answers a request for a buffer published with
+// runtime.PublishBuffer. The data is copied once into C memory, which the
+// stream frees once webkit has read it.
+func (f *Frontend) processBufferRequest(req *C.WebKitURISchemeRequest, token string) {
+	data, ok := common.Buffers.Take(token)
+	if !ok {
+		finishRequestWithError(req, 404, "Buffer not found")
+		return
+	}
+	cMimeType := C.CString("application/octet-stream")
+	defer C.free(unsafe.Pointer(cMimeType))
+	stream := C.g_memory_input_stream_new_from_data(C.CBytes(data), C.long(len(data)), (*[0]byte)(C.free))
+	C.webkit_uri_scheme_request_finish(req, stream, C.long(len(data)), cMimeType)
+	C.g_object_unref(C.gpointer(stream))
+}
+
+func finishRequestWithError(req *C.WebKitURISchemeRequest, code int, text string) {
+	message := C.CString(text)
+	gerr := C.g_error_new_literal(C.g_quark_from_string(message), C.int(code), message)
+	C.webkit_uri_scheme_request_finish_error(req, gerr)
+	C.g_error_free(gerr)
+	C.free(unsafe.Pointer(message))
+}
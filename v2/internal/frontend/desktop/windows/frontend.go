@@ -12,7 +12,6 @@ import (
 	"runtime"
 	"strconv"
 	"strings"
-	"text/template"
 
 	"github.com/leaanthony/go-webview2/pkg/edge"
 	"github.com/leaanthony/winc"
@@ -334,7 +333,7 @@ func (f *Frontend) Notify(name string, data ...interface{}) {
 		f.logger.Error(err.Error())
 		return
 	}
-	f.ExecJS(`window.wails.EventsNotify('` + template.JSEscapeString(string(payload)) + `');`)
+	f.ExecJS(`window.wails.EventsNotify('` + common.EscapeJSString(string(payload)) + `');`)
 }
 
 func (f *Frontend) processRequest(req *edge.ICoreWebView2WebResourceRequest, args *edge.ICoreWebView2WebResourceRequestedEventArgs) {
@@ -352,8 +351,13 @@ func (f *Frontend) processRequest(req *edge.ICoreWebView2WebResourceRequest, arg
 			return
 		}
 
-		// Load file from asset store
-		content, mimeType, err = f.assets.Load(file)
+		if strings.HasPrefix(file, common.BufferPath) {
+			// Published buffers are served as they are
+			content, mimeType, err = common.Buffers.Load(file)
+		} else {
+			// Load file from asset store
+			content, mimeType, err = f.assets.Load(file)
+		}
 	}
 
 	statusCode := 200
@@ -374,7 +378,11 @@ func (f *Frontend) processRequest(req *edge.ICoreWebView2WebResourceRequest, arg
 	if mimeType != "" {
 		headers = append(headers, "Content-Type: "+mimeType)
 	}
-	if content != nil && f.servingFromDisk {
+	cacheHeaders := f.assets.CacheHeaders(file)
+	for header, value := range cacheHeaders {
+		headers = append(headers, header+": "+value)
+	}
+	if content != nil && f.servingFromDisk && cacheHeaders == nil {
 		headers = append(headers, "Pragma: no-cache")
 	}
 
@@ -429,6 +437,13 @@ func (f *Frontend) processMessage(message string) {
 		return
 	}
 
+	if common.IsEventSubscription(message) {
+		if _, err := f.dispatcher.ProcessMessage(message, f); err != nil {
+			f.logger.Error(err.Error())
+		}
+		return
+	}
+
 	go func() {
 		result, err := f.dispatcher.ProcessMessage(message, f)
 		if err != nil {
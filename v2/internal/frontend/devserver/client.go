@@ -0,0 +1,151 @@
+//go:build dev
+// +build dev
+
+package devserver
+
+import (
+	"sync"
+	"time"
+
+	"github.com/gofiber/websocket/v2"
+	"github.com/wailsapp/wails/v2/internal/logger"
+)
+
+const (
+	// The number of messages that can wait to be written to a client
+	clientQueueSize = 1024
+
+	// How long sending waits for room in a client's queue. A client that
+	// stays this far behind is disconnected
+	sendTimeout = time.Second
+
+	// The number of calls a client can have in progress. Reading its
+	// messages waits for one to finish
+	maxClientCalls = 64
+
+	// Queued messages are written together in frames of up to this size
+	maxFrameSize = 64 * 1024
+
+	// How long writing a frame to a client can take
+	writeTimeout = 10 * time.Second
+)
+
+// messageSeparator separates the messages in a frame. It never appears
+// unescaped in JSON, so can't appear in a message.
+const messageSeparator = "\x1e"
+
+// clientConn is the part of a websocket connection used to write to it
+type clientConn interface {
+	WriteMessage(messageType int, data []byte) error
+	SetWriteDeadline(t time.Time) error
+	Close() error
+}
+
+// websocketClient writes to a browser from its own goroutine, so that a slow
+// browser doesn't hold up the others
+type websocketClient struct {
+	conn   clientConn
+	logger *logger.Logger
+
+	queue       chan string
+	sendTimeout time.Duration
+	calls       chan struct{}
+
+	closed    chan struct{}
+	closeOnce sync.Once
+	done      chan struct{}
+}
+
+func newWebsocketClient(conn clientConn, log *logger.Logger) *websocketClient {
+	result := &websocketClient{
+		conn:        conn,
+		logger:      log,
+		queue:       make(chan string, clientQueueSize),
+		sendTimeout: sendTimeout,
+		calls:       make(chan struct{}, maxClientCalls),
+		closed:      make(chan struct{}),
+		done:        make(chan struct{}),
+	}
+	go result.writeMessages()
+	return result
+}
+
+// send queues message to be written. A client that isn't keeping up with its
+// messages is disconnected.
+func (c *websocketClient) send(message string) {
+	select {
+	case <-c.closed:
+		return
+	case c.queue <- message:
+		return
+	default:
+	}
+
+	timer := time.NewTimer(c.sendTimeout)
+	defer timer.Stop()
+	select {
+	case <-c.closed:
+	case c.queue <- message:
+	case <-timer.C:
+		c.logger.Warning("[DevWebServer] Websocket client %p is not reading its messages. Disconnecting", c)
+		c.close()
+	}
+}
+
+// writeMessages writes queued messages until the client is closed. Messages
+// that queue up while a frame is being written are written in one frame.
+func (c *websocketClient) writeMessages() {
+	defer close(c.done)
+	var frame []byte
+	for {
+		select {
+		case <-c.closed:
+			return
+		case message := <-c.queue:
+			frame = append(frame[:0], message...)
+		}
+	batch:
+		for len(frame) < maxFrameSize {
+			select {
+			case message := <-c.queue:
+				frame = append(frame, messageSeparator...)
+				frame = append(frame, message...)
+			default:
+				break batch
+			}
+		}
+
+		err := c.conn.SetWriteDeadline(time.Now().Add(writeTimeout))
+		if err == nil {
+			err = c.conn.WriteMessage(websocket.TextMessage, frame)
+		}
+		if err != nil {
+			c.logger.Error(err.Error())
+			c.close()
+			return
+		}
+	}
+}
+
+// call runs process on a new goroutine, once fewer than maxClientCalls are
+// in progress
+func (c *websocketClient) call(process func()) {
+	c.calls <- struct{}{}
+	go func() {
+		defer func() { <-c.calls }()
+		process()
+	}()
+}
+
+// close closes the connection, which stops the read loop
+func (c *websocketClient) close() {
+	c.closeOnce.Do(func() {
+		close(c.closed)
+		c.conn.Close()
+	})
+}
+
+// wait waits for the writer to stop after the client is closed
+func (c *websocketClient) wait() {
+	<-c.done
+}
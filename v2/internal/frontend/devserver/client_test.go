@@ -0,0 +1,264 @@
+//go:build dev
+// +build dev
+
+package devserver
+
+import (
+	"strconv"
+	"strings"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/wailsapp/wails/v2/internal/frontend"
+	"github.com/wailsapp/wails/v2/internal/logger"
+)
+
+// testConn records the frames written to it. Writes wait for release to be
+// closed.
+type testConn struct {
+	lock     sync.Mutex
+	frames   []string
+	messages int
+	closed   bool
+	release  chan struct{}
+}
+
+func newTestConn() *testConn {
+	result := &testConn{release: make(chan struct{})}
+	close(result.release)
+	return result
+}
+
+func (t *testConn) WriteMessage(messageType int, data []byte) error {
+	<-t.release
+	t.lock.Lock()
+	defer t.lock.Unlock()
+	t.frames = append(t.frames, string(data))
+	t.messages += strings.Count(string(data), messageSeparator) + 1
+	return nil
+}
+
+func (t *testConn) SetWriteDeadline(time.Time) error { return nil }
+
+func (t *testConn) Close() error {
+	t.lock.Lock()
+	defer t.lock.Unlock()
+	t.closed = true
+	return nil
+}
+
+func (t *testConn) received() (frames []string, messages int, closed bool) {
+	t.lock.Lock()
+	defer t.lock.Unlock()
+	return append([]string(nil), t.frames...), t.messages, t.closed
+}
+
+// waitFor polls condition until it is true or a few seconds have passed
+func waitFor(t testing.TB, condition func() bool) {
+	t.Helper()
+	deadline := time.Now().Add(5 * time.Second)
+	for !condition() {
+		if time.Now().After(deadline) {
+			t.Fatal("timed out")
+		}
+		time.Sleep(time.Millisecond)
+	}
+}
+
+func TestClientCoalescesMessages(t *testing.T) {
+	conn := newTestConn()
+	conn.release = make(chan struct{})
+	client := newWebsocketClient(conn, logger.New(nil))
+
+	// The messages queue up behind the first write
+	for i := 0; i < 5; i++ {
+		client.send("n" + strconv.Itoa(i))
+	}
+	close(conn.release)
+	waitFor(t, func() bool {
+		_, messages, _ := conn.received()
+		return messages == 5
+	})
+	client.close()
+	client.wait()
+
+	frames, _, _ := conn.received()
+	if len(frames) > 2 || strings.Join(frames, messageSeparator) != "n0\x1en1\x1en2\x1en3\x1en4" {
+		t.Fatalf("expected the messages in at most 2 frames, got %q", frames)
+	}
+}
+
+func TestSlowClientDisconnected(t *testing.T) {
+	conn := newTestConn()
+	conn.release = make(chan struct{})
+	client := newWebsocketClient(conn, logger.New(nil))
+	client.sendTimeout = 10 * time.Millisecond
+	// The writer takes up to a frame of messages before blocking
+	for i := 0; i < clientQueueSize+maxFrameSize; i++ {
+		client.send("n" + strconv.Itoa(i))
+	}
+	if _, _, closed := conn.received(); !closed {
+		t.Fatal("expected a client that doesn't keep up to be disconnected")
+	}
+	close(conn.release)
+	client.wait()
+}
+
+type testDispatcher struct{}
+
+func (testDispatcher) ProcessMessage(message string, sender frontend.Frontend) (string, error) {
+	time.Sleep(50 * time.Millisecond)
+	return "c" + message[1:], nil
+}
+
+func TestConcurrentCalls(t *testing.T) {
+	d := &DevWebServer{
+		logger:           logger.New(nil),
+		dispatcher:       testDispatcher{},
+		websocketClients: make(map[*websocketClient]struct{}),
+	}
+	conn := newTestConn()
+	client := d.newWebsocketSession(conn)
+
+	start := time.Now()
+	for i := 0; i < 20; i++ {
+		message := "C" + strconv.Itoa(i)
+		client.call(func() {
+			d.processMessage(message, client)
+		})
+	}
+	waitFor(t, func() bool {
+		_, messages, _ := conn.received()
+		return messages == 20
+	})
+	if elapsed := time.Since(start); elapsed > 500*time.Millisecond {
+		t.Errorf("20 calls of 50ms took %s", elapsed)
+	}
+	d.closeWebsocketSession(client)
+}
+
+func TestBroadcastDoesNotBlockConnecting(t *testing.T) {
+	d := &DevWebServer{
+		logger:           logger.New(nil),
+		websocketClients: make(map[*websocketClient]struct{}),
+	}
+	stalled := newTestConn()
+	stalled.release = make(chan struct{})
+	defer close(stalled.release)
+	stalledClient := d.newWebsocketSession(stalled)
+	stalledClient.sendTimeout = time.Second
+	// Fill the queue once the writer is blocked writing the first message
+	stalledClient.send("n")
+	waitFor(t, func() bool {
+		return len(stalledClient.queue) == 0
+	})
+	for i := 0; i < clientQueueSize; i++ {
+		stalledClient.send("n" + strconv.Itoa(i))
+	}
+
+	// This broadcast waits for the stalled client to take the message
+	go d.broadcast("n")
+	time.Sleep(50 * time.Millisecond)
+
+	connected := make(chan *websocketClient)
+	go func() {
+		connected <- d.newWebsocketSession(newTestConn())
+	}()
+	select {
+	case client := <-connected:
+		d.closeWebsocketSession(client)
+	case <-time.After(500 * time.Millisecond):
+		t.Fatal("a broadcast to a slow client blocked a client from connecting")
+	}
+}
+
+// testDesktop records the events it is notified of
+type testDesktop struct {
+	frontend.Frontend
+	lock   sync.Mutex
+	events []string
+}
+
+func (t *testDesktop) Notify(name string, data ...interface{}) {
+	t.lock.Lock()
+	defer t.lock.Unlock()
+	t.events = append(t.events, name)
+}
+
+func TestEventFrameRelayed(t *testing.T) {
+	desktop := &testDesktop{}
+	d := &DevWebServer{
+		logger:           logger.New(nil),
+		desktopFrontend:  desktop,
+		websocketClients: make(map[*websocketClient]struct{}),
+	}
+	senderConn := newTestConn()
+	sender := d.newWebsocketSession(senderConn)
+	otherConn := newTestConn()
+	other := d.newWebsocketSession(otherConn)
+
+	d.notifyFrameExcludingSender("\x02progress\x1f[50,\"a\"]", sender)
+	waitFor(t, func() bool {
+		_, messages, _ := otherConn.received()
+		return messages == 1
+	})
+	d.closeWebsocketSession(sender)
+	d.closeWebsocketSession(other)
+
+	frames, _, _ := otherConn.received()
+	if frames[0] != `n{"name":"progress","data":[50,"a"]}` {
+		t.Errorf("expected the event as JSON, got %q", frames[0])
+	}
+	if frames, _, _ := senderConn.received(); len(frames) != 0 {
+		t.Errorf("expected the sender not to get its own event, got %q", frames)
+	}
+	if len(desktop.events) != 1 || desktop.events[0] != "progress" {
+		t.Errorf("expected the desktop frontend to be notified, got %q", desktop.events)
+	}
+}
+
+// BenchmarkBroadcast50Clients broadcasts events to 50 clients, one of which
+// has stopped reading. It reports how long the other clients take to
+// receive each event.
+func BenchmarkBroadcast50Clients(b *testing.B) {
+	d := &DevWebServer{
+		logger:           logger.New(nil),
+		websocketClients: make(map[*websocketClient]struct{}),
+	}
+	stalled := newTestConn()
+	stalled.release = make(chan struct{})
+	defer close(stalled.release)
+	d.newWebsocketSession(stalled).sendTimeout = 10 * time.Millisecond
+
+	var conns []*testConn
+	for i := 0; i < 49; i++ {
+		conn := newTestConn()
+		conns = append(conns, conn)
+		d.newWebsocketSession(conn)
+	}
+
+	b.ReportAllocs()
+	start := time.Now()
+	for i := 0; i < b.N; i++ {
+		d.notify("progress", i)
+	}
+	for _, conn := range conns {
+		waitFor(b, func() bool {
+			_, messages, _ := conn.received()
+			return messages == b.N
+		})
+	}
+	elapsed := time.Since(start)
+
+	var frames int
+	for _, conn := range conns {
+		received, _, _ := conn.received()
+		frames += len(received)
+	}
+	b.ReportMetric(float64(elapsed.Nanoseconds())/float64(b.N), "ns/event")
+	b.ReportMetric(float64(frames)/float64(len(conns)*b.N), "frames/event")
+	if _, _, closed := stalled.received(); !closed && b.N > clientQueueSize+1 {
+		b.Fatal("the stalled client was not disconnected")
+	}
+}
@@ -20,6 +20,7 @@ import (
 	"github.com/wailsapp/wails/v2/internal/binding"
 	"github.com/wailsapp/wails/v2/internal/frontend"
 	"github.com/wailsapp/wails/v2/internal/frontend/assetserver"
+	"github.com/wailsapp/wails/v2/internal/frontend/dispatcher"
 	"github.com/wailsapp/wails/v2/internal/logger"
 	"github.com/wailsapp/wails/v2/internal/menumanager"
 	"github.com/wailsapp/wails/v2/pkg/menu"
@@ -35,7 +36,7 @@ type DevWebServer struct {
 	dispatcher       frontend.Dispatcher
 	assetServer      *assetserver.BrowserAssetServer
 	socketMutex      sync.Mutex
-	websocketClients map[*websocket.Conn]*sync.Mutex
+	websocketClients map[*websocketClient]struct{}
 	menuManager      *menumanager.Manager
 	starttime        string
 
@@ -62,43 +63,38 @@ func (d *DevWebServer) Run(ctx context.Context) error {
 	})
 
 	d.server.Get("/wails/ipc", websocket.New(func(c *websocket.Conn) {
-		d.newWebsocketSession(c)
-		locker := d.websocketClients[c]
+		client := d.newWebsocketSession(c)
+		defer d.closeWebsocketSession(client)
 		// websocket.Conn bindings https://pkg.go.dev/github.com/fasthttp/websocket?tab=doc#pkg-index
-		var (
-			mt  int
-			msg []byte
-			err error
-		)
-
 		for {
-			if mt, msg, err = c.ReadMessage(); err != nil {
+			_, msg, err := c.ReadMessage()
+			if err != nil {
 				break
 			}
+			message := string(msg)
+
 			// We do not support drag in browsers
-			if string(msg) == "drag" {
+			if message == "drag" {
 				continue
 			}
 
-			// Notify the other browsers of "EventEmit"
-			if len(msg) > 2 && strings.HasPrefix(string(msg), "EE") {
-				d.notifyExcludingSender(msg, c)
+			// Notify the other browsers of "EventEmit", which is sent as an
+			// event frame with CompactIPC
+			if len(message) > 2 && strings.HasPrefix(message, "EE") {
+				d.notifyExcludingSender(msg, client)
+			} else if dispatcher.IsEventFrame(message) {
+				d.notifyFrameExcludingSender(message, client)
 			}
 
-			// Send the message to dispatch to the frontend
-			result, err := d.dispatcher.ProcessMessage(string(msg), d)
-			if err != nil {
-				d.logger.Error(err.Error())
-			}
-			if result != "" {
-				locker.Lock()
-				if err = c.WriteMessage(mt, []byte(result)); err != nil {
-					locker.Unlock()
-					break
-				}
-				locker.Unlock()
+			// Calls can take a while, so are processed concurrently. Other
+			// messages are processed in order
+			if isCall(message) {
+				client.call(func() {
+					d.processMessage(message, client)
+				})
+				continue
 			}
-
+			d.processMessage(message, client)
 		}
 	}))
 
@@ -252,6 +248,10 @@ func (d *DevWebServer) Notify(name string, data ...interface{}) {
 	d.notify(name, data...)
 }
 
+// MultiPage marks the dev server as serving several browsers, so it is
+// notified of all events
+func (d *DevWebServer) MultiPage() {}
+
 func (d *DevWebServer) loadAsset(ctx *fiber.Ctx) error {
 	data, mimetype, err := d.assetServer.Load(ctx.Path())
 	if err != nil {
@@ -270,6 +270,9 @@ func (d *DevWebServer) loadAsset(ctx *fiber.Ctx) error {
 		return err
 	}
 	ctx.Set("Content-Type", mimetype)
+	for header, value := range d.assetServer.CacheHeaders(ctx.Path()) {
+		ctx.Set(header, value)
+	}
 	err = ctx.Send(data)
 	if err != nil {
 		return err
@@ -281,18 +284,41 @@ func (d *DevWebServer) LogDebug(message string, args ...interface{}) {
 	d.logger.Debug("[DevWebServer] "+message, args...)
 }
 
-func (d *DevWebServer) newWebsocketSession(c *websocket.Conn) {
+// isCall returns true for call messages and call frames (see
+// dispatcher/frames.go)
+func isCall(message string) bool {
+	return len(message) > 0 && (message[0] == 'C' || message[0] == 0x01)
+}
+
+// processMessage dispatches a message from client and sends it the result
+func (d *DevWebServer) processMessage(message string, client *websocketClient) {
+	result, err := d.dispatcher.ProcessMessage(message, d)
+	if err != nil {
+		d.logger.Error(err.Error())
+	}
+	if result != "" {
+		client.send(result)
+	}
+}
+
+func (d *DevWebServer) newWebsocketSession(c clientConn) *websocketClient {
+	client := newWebsocketClient(c, d.logger)
 	d.socketMutex.Lock()
-	defer d.socketMutex.Unlock()
-	c.SetCloseHandler(func(code int, text string) error {
-		d.socketMutex.Lock()
-		defer d.socketMutex.Unlock()
-		delete(d.websocketClients, c)
-		d.LogDebug(fmt.Sprintf("Websocket client %p disconnected", c))
-		return nil
-	})
-	d.websocketClients[c] = &sync.Mutex{}
-	d.LogDebug(fmt.Sprintf("Websocket client %p connected", c))
+	d.websocketClients[client] = struct{}{}
+	d.socketMutex.Unlock()
+	d.LogDebug(fmt.Sprintf("Websocket client %p connected", client))
+	return client
+}
+
+// closeWebsocketSession closes the client and waits for its writer to stop,
+// as the connection can't be used once the handler returns
+func (d *DevWebServer) closeWebsocketSession(client *websocketClient) {
+	d.socketMutex.Lock()
+	delete(d.websocketClients, client)
+	d.socketMutex.Unlock()
+	client.close()
+	client.wait()
+	d.LogDebug(fmt.Sprintf("Websocket client %p disconnected", client))
 }
 
 type EventNotify struct {
@@ -301,24 +327,7 @@ type EventNotify struct {
 }
 
 func (d *DevWebServer) broadcast(message string) {
-	d.socketMutex.Lock()
-	defer d.socketMutex.Unlock()
-	for client, locker := range d.websocketClients {
-		go func() {
-			if client == nil {
-				d.logger.Error("Lost connection to websocket server")
-				return
-			}
-			locker.Lock()
-			err := client.WriteMessage(websocket.TextMessage, []byte(message))
-			if err != nil {
-				locker.Unlock()
-				d.logger.Error(err.Error())
-				return
-			}
-			locker.Unlock()
-		}()
-	}
+	d.broadcastExcludingSender(message, nil)
 }
 
 func (d *DevWebServer) notify(name string, data ...interface{}) {
@@ -335,27 +344,25 @@ func (d *DevWebServer) notify(name string, data ...interface{}) {
 	d.broadcast("n" + string(payload))
 }
 
-func (d *DevWebServer) broadcastExcludingSender(message string, sender *websocket.Conn) {
+// broadcastExcludingSender sends message to every client but sender. A send
+// can wait for a slow client, so it isn't done while holding socketMutex,
+// which clients need to connect and disconnect.
+func (d *DevWebServer) broadcastExcludingSender(message string, sender *websocketClient) {
 	d.socketMutex.Lock()
-	defer d.socketMutex.Unlock()
-	for client, locker := range d.websocketClients {
-		go func() {
-			if client == sender {
-				return
-			}
-			locker.Lock()
-			err := client.WriteMessage(websocket.TextMessage, []byte(message))
-			if err != nil {
-				locker.Unlock()
-				d.logger.Error(err.Error())
-				return
-			}
-			locker.Unlock()
-		}()
+	clients := make([]*websocketClient, 0, len(d.websocketClients))
+	for client := range d.websocketClients {
+		if client != sender {
+			clients = append(clients, client)
+		}
+	}
+	d.socketMutex.Unlock()
+
+	for _, client := range clients {
+		client.send(message)
 	}
 }
 
-func (d *DevWebServer) notifyExcludingSender(eventMessage []byte, sender *websocket.Conn) {
+func (d *DevWebServer) notifyExcludingSender(eventMessage []byte, sender *websocketClient) {
 	message := "n" + string(eventMessage[2:])
 	d.broadcastExcludingSender(message, sender)
 
@@ -368,6 +375,27 @@ func (d *DevWebServer) notifyExcludingSender(eventMessage []byte, sender *websoc
 	d.desktopFrontend.Notify(notifyMessage.Name, notifyMessage.Data...)
 }
 
+// notifyFrameExcludingSender notifies the other browsers and the desktop
+// frontend of an event frame (see dispatcher/frames.go). Browsers are sent
+// the event as JSON, as their runtime doesn't read frames.
+func (d *DevWebServer) notifyFrameExcludingSender(frame string, sender *websocketClient) {
+	name, data, err := dispatcher.ParseEventFrame(frame)
+	if err != nil {
+		d.logger.Error(err.Error())
+		return
+	}
+	payload, err := json.Marshal(EventNotify{
+		Name: name,
+		Data: data,
+	})
+	if err != nil {
+		d.logger.Error(err.Error())
+		return
+	}
+	d.broadcastExcludingSender("n"+string(payload), sender)
+	d.desktopFrontend.Notify(name, data...)
+}
+
 func NewFrontend(ctx context.Context, appoptions *options.App, myLogger *logger.Logger, appBindings *binding.Bindings, dispatcher frontend.Dispatcher, menuManager *menumanager.Manager, desktopFrontend frontend.Frontend) *DevWebServer {
 	result := &DevWebServer{
 		ctx:             ctx,
@@ -382,7 +410,7 @@ func NewFrontend(ctx context.Context, appoptions *options.App, myLogger *logger.
 			DisableStartupMessage: true,
 		}),
 		menuManager:      menuManager,
-		websocketClients: make(map[*websocket.Conn]*sync.Mutex),
+		websocketClients: make(map[*websocketClient]struct{}),
 	}
 	return result
 }
@@ -3,14 +3,19 @@ package dispatcher
 import (
 	"encoding/json"
 	"fmt"
-	"github.com/wailsapp/wails/v2/internal/frontend"
 	"strings"
+
+	"github.com/wailsapp/wails/v2/internal/binding"
+	"github.com/wailsapp/wails/v2/internal/frontend"
 )
 
 type callMessage struct {
 	Name       string            `json:"name"`
 	Args       []json.RawMessage `json:"args"`
 	CallbackID string            `json:"callbackID"`
+
+	// method is set when the frame gave the method ID rather than its name
+	method *binding.BoundMethod
 }
 
 func (d *Dispatcher) processCallMessage(message string, sender frontend.Frontend) (string, error) {
@@ -20,16 +25,26 @@ func (d *Dispatcher) processCallMessage(message string, sender frontend.Frontend
 	if err != nil {
 		return "", err
 	}
+	return d.processCall(payload, sender)
+}
+
+// processCall calls the method or system call described by payload and
+// returns the callback message
+func (d *Dispatcher) processCall(payload callMessage, sender frontend.Frontend) (string, error) {
 
 	var result interface{}
+	var err error
 
 	// Handle different calls
 	switch true {
-	case strings.HasPrefix(payload.Name, systemCallPrefix):
+	case payload.method == nil && strings.HasPrefix(payload.Name, systemCallPrefix):
 		result, err = d.processSystemCall(payload, sender)
 	default:
 		// Lookup method
-		registeredMethod := d.bindingsDB.GetMethod(payload.Name)
+		registeredMethod := payload.method
+		if registeredMethod == nil {
+			registeredMethod = d.bindingsDB.GetMethod(payload.Name)
+		}
 
 		// Check we have it
 		if registeredMethod == nil {
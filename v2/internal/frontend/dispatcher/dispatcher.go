@@ -41,6 +41,10 @@ func (d *Dispatcher) ProcessMessage(message string, sender frontend.Frontend) (s
 	case 'Q':
 		sender.Quit()
 		return "", nil
+	case frameCall:
+		return d.processCallFrame(message, sender)
+	case frameEvent:
+		return d.processEventFrame(message, sender)
 	default:
 		return "", errors.New("Unknown message from front end: " + message)
 	}
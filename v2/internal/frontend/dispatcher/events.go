@@ -24,8 +24,11 @@ func (d *Dispatcher) processEventMessage(message string, sender frontend.Fronten
 			return "", err
 		}
 		go d.events.Notify(sender, eventMessage.Name, eventMessage.Data)
+	case 'O':
+		d.events.Subscribe(sender, message[2:])
 	case 'X':
 		eventName := message[2:]
+		d.events.Unsubscribe(sender, eventName)
 		go d.events.Off(eventName)
 	}
 
@@ -0,0 +1,133 @@
+package dispatcher
+
+import (
+	"encoding/json"
+	"errors"
+	"fmt"
+	"math"
+	"strconv"
+	"strings"
+
+	"github.com/wailsapp/wails/v2/internal/frontend"
+)
+
+// Compact frames
+//
+// When the backend announces support for them in window.wailsipc, the
+// runtime sends calls and events as compact frames instead of "C" and "EE"
+// text messages. A frame starts with a type byte that no text message starts
+// with, so both formats can be mixed freely:
+//
+//	call:  0x01 <callbackID> <methodID> <name> 0x1F <args JSON array>
+//	event: 0x02 <name> 0x1F <data JSON array>
+//
+// callbackID and methodID are varints. methodID is the ID the method was
+// given in the bindings DB, in which case name is empty. A methodID of 0
+// means the method is given by name, eg: for system calls. Messages are
+// passed to Go as (NUL terminated) strings, so varints are written as
+// printable ASCII: 5 bits per byte, least significant group first, each
+// byte being 0x40|bits with 0x20 set on all but the last byte.
+const (
+	frameCall      = 0x01
+	frameEvent     = 0x02
+	frameSeparator = 0x1f
+)
+
+var errInvalidVarint = errors.New("invalid varint in frame")
+
+// readVarint decodes the varint starting at message[index] and returns it
+// with the index of the byte after it
+func readVarint(message string, index int) (uint64, int, error) {
+	var result uint64
+	for shift := uint(0); shift < 64; shift += 5 {
+		if index >= len(message) {
+			return 0, index, errInvalidVarint
+		}
+		c := message[index]
+		index++
+		if c&0xc0 != 0x40 {
+			return 0, index, errInvalidVarint
+		}
+		result |= uint64(c&0x1f) << shift
+		if c&0x20 == 0 {
+			return result, index, nil
+		}
+	}
+	return 0, index, errInvalidVarint
+}
+
+// splitFrame splits the remainder of a frame into the name and the payload
+func splitFrame(message string, index int) (string, string, error) {
+	separator := strings.IndexByte(message[index:], frameSeparator)
+	if separator == -1 {
+		return "", "", errors.New("missing separator in frame")
+	}
+	return message[index : index+separator], message[index+separator+1:], nil
+}
+
+func (d *Dispatcher) processCallFrame(message string, sender frontend.Frontend) (string, error) {
+	callbackID, index, err := readVarint(message, 1)
+	if err != nil {
+		return "", err
+	}
+	methodID, index, err := readVarint(message, index)
+	if err != nil {
+		return "", err
+	}
+	name, args, err := splitFrame(message, index)
+	if err != nil {
+		return "", err
+	}
+
+	payload := callMessage{
+		Name:       name,
+		CallbackID: strconv.FormatUint(callbackID, 10),
+	}
+	if methodID != 0 {
+		if methodID > math.MaxInt32 {
+			return "", fmt.Errorf("unknown method ID %d", methodID)
+		}
+		payload.method = d.bindingsDB.GetMethodByID(int(methodID))
+		if payload.method == nil {
+			return "", fmt.Errorf("unknown method ID %d", methodID)
+		}
+		payload.Name = payload.method.Name
+	}
+	if args != "" {
+		err = json.Unmarshal([]byte(args), &payload.Args)
+		if err != nil {
+			return "", err
+		}
+	}
+	return d.processCall(payload, sender)
+}
+
+// IsEventFrame returns true if message is an event frame
+func IsEventFrame(message string) bool {
+	return len(message) > 0 && message[0] == frameEvent
+}
+
+// ParseEventFrame returns the name and data of an event frame
+func ParseEventFrame(message string) (string, []interface{}, error) {
+	name, data, err := splitFrame(message, 1)
+	if err != nil {
+		return "", nil, err
+	}
+	var eventData []interface{}
+	if data != "" {
+		err = json.Unmarshal([]byte(data), &eventData)
+		if err != nil {
+			return "", nil, err
+		}
+	}
+	return name, eventData, nil
+}
+
+func (d *Dispatcher) processEventFrame(message string, sender frontend.Frontend) (string, error) {
+	name, eventData, err := ParseEventFrame(message)
+	if err != nil {
+		return "", err
+	}
+	go d.events.Notify(sender, name, eventData)
+	return "", nil
+}
@@ -0,0 +1,229 @@
+package dispatcher
+
+import (
+	"encoding/json"
+	"errors"
+	"reflect"
+	"strconv"
+	"testing"
+	"time"
+
+	"github.com/wailsapp/wails/v2/internal/binding"
+	"github.com/wailsapp/wails/v2/internal/frontend"
+	"github.com/wailsapp/wails/v2/internal/logger"
+)
+
+type TestApp struct{}
+
+func (t *TestApp) Noop() {}
+
+func (t *TestApp) Greet(name string, count int) string {
+	return "Hello " + name + " x" + strconv.Itoa(count)
+}
+
+func (t *TestApp) Fail() error {
+	return errors.New("failed")
+}
+
+type notification struct {
+	name string
+	data []interface{}
+}
+
+// testEvents records the notifications sent by the dispatcher
+type testEvents struct {
+	frontend.Events
+	notified chan notification
+}
+
+func (t *testEvents) Notify(sender frontend.Frontend, name string, data ...interface{}) {
+	t.notified <- notification{name, data}
+}
+
+func newTestDispatcher() (*Dispatcher, *testEvents) {
+	log := logger.New(nil)
+	events := &testEvents{notified: make(chan notification, 1)}
+	bindings := binding.NewBindings(log, []interface{}{&TestApp{}}, nil)
+	return NewDispatcher(log, bindings, events), events
+}
+
+// appendVarint appends the encoding of value read by readVarint
+func appendVarint(buffer []byte, value uint64) []byte {
+	for value >= 0x20 {
+		buffer = append(buffer, byte(0x60|value&0x1f))
+		value >>= 5
+	}
+	return append(buffer, byte(0x40|value))
+}
+
+// callFrame returns a call frame for the given method ID, or for name if
+// methodID is 0
+func callFrame(callbackID uint64, methodID uint64, name string, args string) string {
+	frame := appendVarint([]byte{frameCall}, callbackID)
+	frame = appendVarint(frame, methodID)
+	if methodID == 0 {
+		frame = append(frame, name...)
+	}
+	frame = append(frame, frameSeparator)
+	return string(append(frame, args...))
+}
+
+func TestVarint(t *testing.T) {
+	values := []uint64{0, 1, 31, 32, 33, 1023, 1024, 1 << 32, 1<<64 - 1}
+	for _, value := range values {
+		encoded := appendVarint(nil, value)
+		for _, c := range encoded {
+			if c < 0x40 || c > 0x7f {
+				t.Fatalf("%d encoded to non printable byte %#x", value, c)
+			}
+		}
+		decoded, next, err := readVarint(string(encoded)+"rest", 0)
+		if err != nil || decoded != value || next != len(encoded) {
+			t.Fatalf("%d: decoded %d, next %d, err %v", value, decoded, next, err)
+		}
+	}
+	for _, invalid := range []string{"", "`", "a", "\x01", "````````````````"} {
+		if _, _, err := readVarint(invalid, 0); err == nil {
+			t.Errorf("expected an error decoding %q", invalid)
+		}
+	}
+}
+
+// TestCallFrameMatchesText checks that a frame gives the same callback as the
+// equivalent text message
+func TestCallFrameMatchesText(t *testing.T) {
+	d, _ := newTestDispatcher()
+	calls := []struct {
+		name string
+		args string
+	}{
+		{"dispatcher.TestApp.Noop", `[]`},
+		{"dispatcher.TestApp.Noop", ``},
+		{"dispatcher.TestApp.Greet", `["bob",3]`},
+		{"dispatcher.TestApp.Greet", `["\u001f <script>",-1]`},
+		{"dispatcher.TestApp.Greet", `["bob"]`},
+		{"dispatcher.TestApp.Fail", `[]`},
+	}
+	for index, call := range calls {
+		textMessage := callMessage{Name: call.name, CallbackID: strconv.Itoa(index)}
+		if call.args != "" {
+			json.Unmarshal([]byte(call.args), &textMessage.Args)
+		}
+		text, _ := json.Marshal(textMessage)
+		textResult, textErr := d.ProcessMessage("C"+string(text), nil)
+		frameResult, frameErr := d.ProcessMessage(callFrame(uint64(index), 0, call.name, call.args), nil)
+		if textResult != frameResult || (textErr == nil) != (frameErr == nil) {
+			t.Errorf("%s(%s): frame returned %q (%v), text returned %q (%v)", call.name, call.args, frameResult, frameErr, textResult, textErr)
+		}
+
+		methodID := uint64(d.bindingsDB.GetMethod(call.name).ID)
+		idResult, idErr := d.ProcessMessage(callFrame(uint64(index), methodID, "", call.args), nil)
+		if textResult != idResult || (textErr == nil) != (idErr == nil) {
+			t.Errorf("%s(%s): frame with ID returned %q (%v), text returned %q (%v)", call.name, call.args, idResult, idErr, textResult, textErr)
+		}
+	}
+}
+
+// TestRuntimeFrames checks frames as encoded by desktop/frames.js
+func TestRuntimeFrames(t *testing.T) {
+	d, events := newTestDispatcher()
+
+	result, err := d.ProcessMessage("\x01jA@dispatcher.TestApp.Greet\x1f[\"x\",1]", nil)
+	if err != nil || result != `c{"result":"Hello x x1","error":"","callbackid":"42"}` {
+		t.Fatalf("unexpected call result %q (%v)", result, err)
+	}
+
+	_, err = d.ProcessMessage("\x02ev\x1f[{\"a\":1},2]", nil)
+	if err != nil {
+		t.Fatal(err)
+	}
+	select {
+	case n := <-events.notified:
+		expected := []interface{}{[]interface{}{map[string]interface{}{"a": 1.0}, 2.0}}
+		if n.name != "ev" || !reflect.DeepEqual(n.data, expected) {
+			t.Fatalf("unexpected notification %+v", n)
+		}
+	case <-time.After(5 * time.Second):
+		t.Fatal("event was not notified")
+	}
+}
+
+func TestInvalidFrames(t *testing.T) {
+	d, _ := newTestDispatcher()
+	invalid := []string{
+		"\x01",
+		"\x01A",
+		"\x01A@dispatcher.TestApp.Noop",
+		"\x01AZ\x1f[]",
+		"\x01A\x7f\x7f\x7f\x7f\x7fA\x1f[]",
+		"\x01A@dispatcher.TestApp.Noop\x1f[",
+		"\x01A@dispatcher.TestApp.Missing\x1f[]",
+		"\x02name",
+		"\x02name\x1f{",
+	}
+	for _, message := range invalid {
+		if _, err := d.ProcessMessage(message, nil); err == nil {
+			t.Errorf("expected an error for %q", message)
+		}
+	}
+}
+
+// BenchmarkProcessCall compares the text and frame formats for a call with
+// a couple of arguments
+func BenchmarkProcessCall(b *testing.B) {
+	const name = "dispatcher.TestApp.Greet"
+	const args = `["world",42]`
+	text, _ := json.Marshal(callMessage{
+		Name:       name,
+		Args:       []json.RawMessage{json.RawMessage(`"world"`), json.RawMessage(`42`)},
+		CallbackID: name + "-3735928559",
+	})
+	messages := []struct {
+		format  string
+		message string
+	}{
+		{"text", "C" + string(text)},
+		{"frame", callFrame(3735928559, 0, name, args)},
+	}
+	for _, m := range messages {
+		message := m.message
+		b.Run(m.format, func(b *testing.B) {
+			d, _ := newTestDispatcher()
+			b.ReportAllocs()
+			start := time.Now()
+			for i := 0; i < b.N; i++ {
+				if _, err := d.ProcessMessage(message, nil); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.ReportMetric(float64(b.N)/time.Since(start).Seconds(), "calls/s")
+			b.ReportMetric(float64(len(message)), "bytes/msg")
+		})
+	}
+}
+
+// BenchmarkNoopCall calls a method that does nothing, looking it up by name
+// and by ID
+func BenchmarkNoopCall(b *testing.B) {
+	d, _ := newTestDispatcher()
+	const name = "dispatcher.TestApp.Noop"
+	methodID := uint64(d.bindingsDB.GetMethod(name).ID)
+	messages := []struct {
+		lookup  string
+		message string
+	}{
+		{"name", callFrame(1, 0, name, "[]")},
+		{"id", callFrame(1, methodID, "", "[]")},
+	}
+	for _, m := range messages {
+		message := m.message
+		b.Run(m.lookup, func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if _, err := d.ProcessMessage(message, nil); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
@@ -1,5 +1,7 @@
 package frontend
 
+import "time"
+
 type Events interface {
 	On(eventName string, callback func(...interface{}))
 	OnMultiple(eventName string, callback func(...interface{}), counter int)
@@ -7,4 +9,49 @@ type Events interface {
 	Emit(eventName string, data ...interface{})
 	Off(eventName string)
 	Notify(sender Frontend, name string, data ...interface{})
+
+	// Subscribe and Unsubscribe record which events the page in sender has
+	// listeners for. Frontends are only notified of those events.
+	Subscribe(sender Frontend, eventName string)
+	Unsubscribe(sender Frontend, eventName string)
+
+	// SetPolicy sets how often an event emitted in Go is sent to the
+	// frontends. PolicyStats returns the counters for its policy.
+	SetPolicy(eventName string, policy EventPolicy)
+	PolicyStats(eventName string) EventPolicyStats
+}
+
+type EventDelivery string
+
+const (
+	// Every event is sent as it is emitted. This is the default
+	DeliverEvery EventDelivery = ""
+	// The first event is sent as it is emitted. Later events replace each
+	// other and the latest is sent at the end of each interval
+	DeliverLatest EventDelivery = "latest"
+	// Events are collected and sent once per interval as a single event.
+	// Its data is an array holding the data of each event
+	DeliverBatch EventDelivery = "batch"
+	// At most one event is sent per interval. Others are dropped
+	DeliverThrottled EventDelivery = "throttled"
+)
+
+// EventPolicy limits how often an event emitted in Go is sent to the
+// frontends. Go listeners are always called for every event.
+type EventPolicy struct {
+	Delivery EventDelivery
+	Interval time.Duration // Defaults to 16ms, about a frame
+}
+
+// EventPolicyStats counts the events an EventPolicy held back
+type EventPolicyStats struct {
+	Coalesced uint64 // Replaced by a later event with DeliverLatest
+	Dropped   uint64 // Dropped with DeliverThrottled
+}
+
+// MultiPageFrontend is implemented by frontends that serve several pages
+// at once, such as the dev server. Their subscriptions can't be attributed
+// to a single page, so they are notified of every event.
+type MultiPageFrontend interface {
+	MultiPage()
 }
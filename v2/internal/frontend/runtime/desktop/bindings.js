@@ -38,6 +38,9 @@ export function SetBindings(bindingsMap) {
 
 			Object.keys(bindingsMap[packageName][structName]).forEach((methodName) => {
 
+				// Calls are sent with the method ID if the backend gave one
+				const methodID = bindingsMap[packageName][structName][methodName].id;
+
 				window.go[packageName][structName][methodName] = function () {
 
 					// No timeout by default
@@ -46,7 +49,7 @@ export function SetBindings(bindingsMap) {
 					// Actual function
 					function dynamic() {
 						const args = [].slice.call(arguments);
-						return Call([packageName, structName, methodName].join('.'), args, timeout);
+						return Call([packageName, structName, methodName].join('.'), args, timeout, methodID);
 					}
 
 					// Allow setting timeout to function
@@ -9,8 +9,13 @@ The electron alternative for Go
 */
 /* jshint esversion: 6 */
 
+import {CallFrame, compactFrames} from './frames';
+
 export const callbacks = {};
 
+// Compact frames carry a numeric callback ID
+let nextCallbackID = 1;
+
 /**
  * Returns a number from the native browser random function
  *
@@ -52,9 +57,10 @@ if (window.crypto) {
  * @param {string} name
  * @param {any=} args
  * @param {number=} timeout
+ * @param {number=} methodID
  * @returns
  */
-export function Call(name, args, timeout) {
+export function Call(name, args, timeout, methodID) {
 
 	// Timeout infinite by default
 	if (timeout == null) {
@@ -65,10 +71,15 @@ export function Call(name, args, timeout) {
 	return new Promise(function (resolve, reject) {
 
 		// Create a unique callbackID
+		var compact = compactFrames();
 		var callbackID;
-		do {
-			callbackID = name + '-' + randomFunc();
-		} while (callbacks[callbackID]);
+		if (compact) {
+			callbackID = nextCallbackID++;
+		} else {
+			do {
+				callbackID = name + '-' + randomFunc();
+			} while (callbacks[callbackID]);
+		}
 
 		var timeoutHandle;
 		// Set timeout
@@ -86,14 +97,17 @@ export function Call(name, args, timeout) {
 		};
 
 		try {
-			const payload = {
-				name,
-				args,
-				callbackID,
-			};
-
 			// Make the call
-			window.WailsInvoke('C' + JSON.stringify(payload));
+			if (compact) {
+				window.WailsInvoke(CallFrame(callbackID, name, args, methodID));
+			} else {
+				const payload = {
+					name,
+					args,
+					callbackID,
+				};
+				window.WailsInvoke('C' + JSON.stringify(payload));
+			}
 		} catch (e) {
 			// eslint-disable-next-line
 			console.error(e);
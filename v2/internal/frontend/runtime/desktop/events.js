@@ -9,6 +9,8 @@ The electron alternative for Go
 */
 /* jshint esversion: 6 */
 
+import {EventFrame, compactFrames} from './frames';
+
 // Defines a single listener with a maximum number of times to callback
 
 /**
@@ -53,6 +55,10 @@ export const eventListeners = {};
  */
 export function EventsOnMultiple(eventName, callback, maxCallbacks) {
     eventListeners[eventName] = eventListeners[eventName] || [];
+    // Go only sends the events this page listens for
+    if (eventListeners[eventName].length === 0) {
+        window.WailsInvoke('EO' + eventName);
+    }
     const thisListener = new Listener(callback, maxCallbacks);
     eventListeners[eventName].push(thisListener);
 }
@@ -147,7 +153,8 @@ export function EventsEmit(eventName) {
     notifyListeners(payload);
 
     // Notify Go listeners
-    window.WailsInvoke('EE' + JSON.stringify(payload));
+    const frame = compactFrames() ? EventFrame(payload.name, payload.data) : null;
+    window.WailsInvoke(frame !== null ? frame : 'EE' + JSON.stringify(payload));
 }
 
 export function EventsOff(eventName) {
@@ -0,0 +1,69 @@
+/*
+ _       __      _ __
+| |     / /___ _(_) /____
+| | /| / / __ `/ / / ___/
+| |/ |/ / /_/ / / (__  )
+|__/|__/\__,_/_/_/____/
+The electron alternative for Go
+(c) Lea Anthony 2019-present
+*/
+/* jshint esversion: 6 */
+
+// Compact frames. The format is described in dispatcher/frames.go
+const frameCall = '\x01';
+const frameEvent = '\x02';
+const frameSeparator = '\x1f';
+
+/**
+ * Returns true if the backend has announced it accepts compact frames
+ *
+ * @returns boolean
+ */
+export function compactFrames() {
+	return !!(window.wailsipc && window.wailsipc.compact);
+}
+
+/**
+ * Encodes a non-negative integer as a printable varint
+ *
+ * @param {number} value
+ * @returns string
+ */
+function varint(value) {
+	let result = '';
+	while (value >= 32) {
+		result += String.fromCharCode(0x60 | (value % 32));
+		value = Math.floor(value / 32);
+	}
+	return result + String.fromCharCode(0x40 | value);
+}
+
+/**
+ * Returns the frame for a call. The method is sent as its ID if it has one,
+ * otherwise by name. Binding names are Go identifiers so never contain the
+ * separator.
+ *
+ * @param {number} callbackID
+ * @param {string} name
+ * @param {any[]=} args
+ * @param {number=} methodID
+ * @returns string
+ */
+export function CallFrame(callbackID, name, args, methodID) {
+	const method = methodID ? varint(methodID) : varint(0) + name;
+	return frameCall + varint(callbackID) + method + frameSeparator + (args ? JSON.stringify(args) : '');
+}
+
+/**
+ * Returns the frame for an event, or null if the name can't be framed
+ *
+ * @param {string} name
+ * @param {any[]} data
+ * @returns string
+ */
+export function EventFrame(name, data) {
+	if (name.indexOf(frameSeparator) !== -1) {
+		return null;
+	}
+	return frameEvent + name + frameSeparator + JSON.stringify(data);
+}
@@ -99,23 +99,32 @@ function connect() {
 }
 
 function handleMessage(message) {
+    // Messages that queue up in the backend are sent in one frame,
+    // separated by the record separator
+    const messages = message.data.split('\x1e');
+    for (let i = 0; i < messages.length; i++) {
+        processMessage(messages[i]);
+    }
+}
+
+function processMessage(message) {
 
-    if (message.data === "reload") {
+    if (message === "reload") {
         window.runtime.WindowReload();
         return;
     }
 
     // As a bridge we ignore js and css injections
-    switch (message.data[0]) {
+    switch (message[0]) {
         // Notifications
         case 'n':
-            window.wails.EventsNotify(message.data.slice(1));
+            window.wails.EventsNotify(message.slice(1));
             break;
         case 'c':
-            const callbackData = message.data.slice(1);
+            const callbackData = message.slice(1);
             window.wails.Callback(callbackData);
             break;
         default:
-            log('Unknown message: ' + message.data);
+            log('Unknown message: ' + message);
     }
 }
@@ -0,0 +1,119 @@
+package runtime
+
+import (
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"github.com/wailsapp/wails/v2/internal/frontend"
+)
+
+// defaultPolicyInterval is about a frame at 60Hz
+const defaultPolicyInterval = 16 * time.Millisecond
+
+// eventPolicy applies a frontend.EventPolicy to an event on its way to the
+// frontends
+type eventPolicy struct {
+	coalesced uint64 // Updated atomically
+	dropped   uint64 // Updated atomically
+
+	delivery frontend.EventDelivery
+	interval time.Duration
+	deliver  func(data ...interface{})
+
+	lock     sync.Mutex
+	waiting  bool            // Whether an interval is running
+	pending  [][]interface{} // The data waiting for the end of the interval
+	lastSent time.Time
+}
+
+func newEventPolicy(policy frontend.EventPolicy, deliver func(data ...interface{})) *eventPolicy {
+	result := &eventPolicy{
+		delivery: policy.Delivery,
+		interval: policy.Interval,
+		deliver:  deliver,
+	}
+	if result.interval <= 0 {
+		result.interval = defaultPolicyInterval
+	}
+	return result
+}
+
+// emit sends data now, later or not at all, as the policy decides
+func (p *eventPolicy) emit(data []interface{}) {
+	p.lock.Lock()
+	switch p.delivery {
+	case frontend.DeliverLatest:
+		if p.waiting {
+			if len(p.pending) > 0 {
+				atomic.AddUint64(&p.coalesced, 1)
+			}
+			p.pending = append(p.pending[:0], data)
+			p.lock.Unlock()
+			return
+		}
+		p.waiting = true
+		p.lock.Unlock()
+		p.deliver(data...)
+		time.AfterFunc(p.interval, p.flushLatest)
+
+	case frontend.DeliverBatch:
+		p.pending = append(p.pending, data)
+		if !p.waiting {
+			p.waiting = true
+			time.AfterFunc(p.interval, p.flushBatch)
+		}
+		p.lock.Unlock()
+
+	case frontend.DeliverThrottled:
+		now := time.Now()
+		if now.Sub(p.lastSent) < p.interval {
+			p.lock.Unlock()
+			atomic.AddUint64(&p.dropped, 1)
+			return
+		}
+		p.lastSent = now
+		p.lock.Unlock()
+		p.deliver(data...)
+
+	default:
+		p.lock.Unlock()
+		p.deliver(data...)
+	}
+}
+
+// flushLatest sends the latest event emitted during the interval, if any,
+// and starts another interval after it
+func (p *eventPolicy) flushLatest() {
+	p.lock.Lock()
+	if len(p.pending) == 0 {
+		p.waiting = false
+		p.lock.Unlock()
+		return
+	}
+	data := p.pending[0]
+	p.pending = p.pending[:0]
+	p.lock.Unlock()
+	p.deliver(data...)
+	time.AfterFunc(p.interval, p.flushLatest)
+}
+
+// flushBatch sends the events emitted during the interval as one event
+func (p *eventPolicy) flushBatch() {
+	p.lock.Lock()
+	batch := make([]interface{}, len(p.pending))
+	for index, data := range p.pending {
+		batch[index] = data
+	}
+	p.pending = nil
+	p.waiting = false
+	p.lock.Unlock()
+	p.deliver(batch)
+}
+
+func (p *eventPolicy) stats() frontend.EventPolicyStats {
+	return frontend.EventPolicyStats{
+		Coalesced: atomic.LoadUint64(&p.coalesced),
+		Dropped:   atomic.LoadUint64(&p.dropped),
+	}
+}
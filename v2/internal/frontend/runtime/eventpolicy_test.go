@@ -0,0 +1,127 @@
+package runtime
+
+import (
+	"reflect"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/wailsapp/wails/v2/internal/frontend"
+	"github.com/wailsapp/wails/v2/internal/logger"
+)
+
+func TestEventPolicies(t *testing.T) {
+	tests := []struct {
+		delivery frontend.EventDelivery
+		expected [][]interface{}
+		stats    frontend.EventPolicyStats
+	}{
+		{
+			delivery: frontend.DeliverLatest,
+			expected: [][]interface{}{{0}, {99}},
+			stats:    frontend.EventPolicyStats{Coalesced: 98},
+		},
+		{
+			delivery: frontend.DeliverThrottled,
+			expected: [][]interface{}{{0}},
+			stats:    frontend.EventPolicyStats{Dropped: 99},
+		},
+		{
+			delivery: frontend.DeliverBatch,
+			expected: func() [][]interface{} {
+				batch := make([]interface{}, 100)
+				for i := range batch {
+					batch[i] = []interface{}{i}
+				}
+				return [][]interface{}{{batch}}
+			}(),
+		},
+	}
+	for _, test := range tests {
+		events := NewEvents(logger.New(nil))
+		page := &testFrontend{}
+		events.AddFrontend(page)
+		events.Subscribe(page, "progress")
+		events.SetPolicy("progress", frontend.EventPolicy{Delivery: test.delivery, Interval: 100 * time.Millisecond})
+
+		// Go listeners are called for every event, whatever the policy
+		var goListener int32
+		events.On("progress", func(...interface{}) { atomic.AddInt32(&goListener, 1) })
+		for i := 0; i < 100; i++ {
+			events.Emit("progress", i)
+		}
+		time.Sleep(300 * time.Millisecond)
+
+		if calls := atomic.LoadInt32(&goListener); calls != 100 {
+			t.Errorf("%s: Go listener called %d times, expected 100", test.delivery, calls)
+		}
+
+		page.lock.Lock()
+		if !reflect.DeepEqual(page.data, test.expected) {
+			t.Errorf("%s: page was sent %v, expected %v", test.delivery, page.data, test.expected)
+		}
+		page.lock.Unlock()
+		if stats := events.PolicyStats("progress"); stats != test.stats {
+			t.Errorf("%s: stats %+v, expected %+v", test.delivery, stats, test.stats)
+		}
+	}
+
+	// Removing the policy sends every event again
+	events := NewEvents(logger.New(nil))
+	page := &testFrontend{}
+	events.AddFrontend(page)
+	events.Subscribe(page, "progress")
+	events.SetPolicy("progress", frontend.EventPolicy{Delivery: frontend.DeliverThrottled, Interval: time.Hour})
+	events.SetPolicy("progress", frontend.EventPolicy{})
+	for i := 0; i < 10; i++ {
+		events.Emit("progress", i)
+	}
+	if len(page.data) != 10 {
+		t.Errorf("expected 10 events without a policy, page was sent %d", len(page.data))
+	}
+}
+
+// BenchmarkEmitter10kHz emits an event every 100µs for 100ms per op and
+// reports how many notifications, each a script evaluated by the page, that
+// makes per 60Hz frame
+func BenchmarkEmitter10kHz(b *testing.B) {
+	const frame = time.Second / 60
+	deliveries := []frontend.EventDelivery{
+		frontend.DeliverEvery,
+		frontend.DeliverLatest,
+		frontend.DeliverBatch,
+		frontend.DeliverThrottled,
+	}
+	for _, delivery := range deliveries {
+		name := string(delivery)
+		if name == "" {
+			name = "every"
+		}
+		b.Run(name, func(b *testing.B) {
+			events := NewEvents(logger.New(nil))
+			page := &testFrontend{}
+			events.AddFrontend(page)
+			events.Subscribe(page, "progress")
+			events.SetPolicy("progress", frontend.EventPolicy{Delivery: delivery})
+
+			start := time.Now()
+			for i := 0; i < b.N; i++ {
+				opStart := time.Now()
+				for j := 0; j < 1000; j++ {
+					for time.Since(opStart) < time.Duration(j)*100*time.Microsecond {
+						time.Sleep(20 * time.Microsecond)
+					}
+					events.Emit("progress", map[string]interface{}{"done": j, "total": 1000})
+				}
+			}
+			elapsed := time.Since(start)
+			time.Sleep(2 * defaultPolicyInterval)
+
+			page.lock.Lock()
+			frames := float64(elapsed) / float64(frame)
+			b.ReportMetric(float64(len(page.notified))/frames, "evals/frame")
+			b.ReportMetric(float64(page.sent)/frames, "script-bytes/frame")
+			page.lock.Unlock()
+		})
+	}
+}
@@ -1,35 +1,64 @@
 package runtime
 
 import (
+	"sync"
+	"sync/atomic"
+
 	"github.com/wailsapp/wails/v2/internal/frontend"
 	"github.com/wailsapp/wails/v2/internal/logger"
-	"sync"
 )
 
 // eventListener holds a callback function which is invoked when
 // the event listened for is emitted. It has a counter which indicates
-// how the total number of events it is interested in. A value of zero
+// how the total number of events it is interested in. A negative value
 // means it does not expire (default).
 type eventListener struct {
 	callback func(...interface{}) // Function to call with emitted event data
-	counter  int                  // The number of times this callback may be called. -1 = infinite
-	delete   bool                 // Flag to indicate that this listener should be deleted
+	counter  int32                // The number of times this callback may still be called. Updated atomically
+	limited  bool                 // Whether counter applies. If not, the listener never expires
 }
 
+// The number of goroutines that call listeners and the number of callbacks
+// that can be queued for them. When the queue is full, callbacks run on the
+// notifying goroutine.
+const (
+	eventWorkers   = 16
+	eventQueueSize = 1024
+)
+
 // Events handles eventing
 type Events struct {
 	log      *logger.Logger
 	frontend []frontend.Frontend
 
-	// Go event listeners
-	listeners  map[string][]*eventListener
-	notifyLock sync.RWMutex
+	// Go event listeners, a map[string][]*eventListener. The map and its
+	// slices are never modified: changes replace them with updated copies,
+	// so notifying needs no lock.
+	listeners atomic.Value
+
+	// Serialises changes to listeners
+	listenersLock sync.Mutex
+
+	// Callbacks waiting for a worker. Nil once shut down
+	callbacks     chan func()
+	callbacksLock sync.RWMutex
+	workers       sync.WaitGroup
+
+	// The event names each frontend's page has listeners for, a
+	// map[frontend.Frontend]map[string]struct{}. Replaced like listeners
+	subscriptions     atomic.Value
+	subscriptionsLock sync.Mutex
+
+	// Delivery policies by event name, a map[string]*eventPolicy.
+	// Replaced like listeners
+	policies     atomic.Value
+	policiesLock sync.Mutex
 }
 
 func (e *Events) Notify(sender frontend.Frontend, name string, data ...interface{}) {
 	e.notifyBackend(name, data...)
 	for _, thisFrontend := range e.frontend {
-		if thisFrontend == sender {
+		if thisFrontend == sender || !e.subscribed(thisFrontend, name) {
 			continue
 		}
 		thisFrontend.Notify(name, data...)
@@ -50,7 +79,19 @@ func (e *Events) Once(eventName string, callback func(...interface{})) {
 
 func (e *Events) Emit(eventName string, data ...interface{}) {
 	e.notifyBackend(eventName, data...)
+	if policy := e.policies.Load().(map[string]*eventPolicy)[eventName]; policy != nil {
+		policy.emit(data)
+		return
+	}
+	e.notifyFrontends(eventName, data...)
+}
+
+// notifyFrontends notifies the frontends listening for eventName
+func (e *Events) notifyFrontends(eventName string, data ...interface{}) {
 	for _, thisFrontend := range e.frontend {
+		if !e.subscribed(thisFrontend, eventName) {
+			continue
+		}
 		thisFrontend.Notify(eventName, data...)
 	}
 }
@@ -63,86 +104,218 @@ func (e *Events) Off(eventName string) {
 func NewEvents(log *logger.Logger) *Events {
 	result := &Events{
 		log:       log,
-		listeners: make(map[string][]*eventListener),
+		callbacks: make(chan func(), eventQueueSize),
+	}
+	result.listeners.Store(map[string][]*eventListener{})
+	result.subscriptions.Store(map[frontend.Frontend]map[string]struct{}{})
+	result.policies.Store(map[string]*eventPolicy{})
+	result.workers.Add(eventWorkers)
+	for i := 0; i < eventWorkers; i++ {
+		go result.worker(result.callbacks)
 	}
 	return result
 }
 
+// worker calls queued listeners until the queue is closed
+func (e *Events) worker(callbacks chan func()) {
+	defer e.workers.Done()
+	for callback := range callbacks {
+		callback()
+	}
+}
+
+// queue hands callback to a worker. It returns false if they are all busy
+// or have been shut down.
+func (e *Events) queue(callback func()) bool {
+	e.callbacksLock.RLock()
+	defer e.callbacksLock.RUnlock()
+	if e.callbacks == nil {
+		return false
+	}
+	select {
+	case e.callbacks <- callback:
+		return true
+	default:
+		return false
+	}
+}
+
+// Shutdown stops the workers once they have called the queued listeners.
+// Listeners notified afterwards are called on the notifying goroutine.
+func (e *Events) Shutdown() {
+	e.callbacksLock.Lock()
+	if e.callbacks != nil {
+		close(e.callbacks)
+		e.callbacks = nil
+	}
+	e.callbacksLock.Unlock()
+	e.workers.Wait()
+}
+
+// updateListeners replaces the listeners for eventName with the result of
+// update, which is given the current listeners and must not modify them
+func (e *Events) updateListeners(eventName string, update func([]*eventListener) []*eventListener) {
+	e.listenersLock.Lock()
+	defer e.listenersLock.Unlock()
+
+	current := e.listeners.Load().(map[string][]*eventListener)
+	updated := make(map[string][]*eventListener, len(current)+1)
+	for name, listeners := range current {
+		updated[name] = listeners
+	}
+	listeners := update(current[eventName])
+	if len(listeners) > 0 {
+		updated[eventName] = listeners
+	} else {
+		delete(updated, eventName)
+	}
+	e.listeners.Store(updated)
+}
+
 // registerListener provides a means of subscribing to events of type "eventName"
 func (e *Events) registerListener(eventName string, callback func(...interface{}), counter int) {
-	// Create new eventListener
+	// Create new eventListener. A counter of 0 has always meant once
+	if counter == 0 {
+		counter = 1
+	}
 	thisListener := &eventListener{
 		callback: callback,
-		counter:  counter,
-		delete:   false,
+		counter:  int32(counter),
+		limited:  counter > 0,
 	}
-	e.notifyLock.Lock()
-	// Append the new listener to the listeners slice
-	e.listeners[eventName] = append(e.listeners[eventName], thisListener)
-	e.notifyLock.Unlock()
+	e.updateListeners(eventName, func(listeners []*eventListener) []*eventListener {
+		// Append the new listener to a copy of the listeners slice
+		result := make([]*eventListener, len(listeners), len(listeners)+1)
+		copy(result, listeners)
+		return append(result, thisListener)
+	})
 }
 
 // unRegisterListener provides a means of unsubscribing to events of type "eventName"
 func (e *Events) unRegisterListener(eventName string) {
-	e.notifyLock.Lock()
 	// Clear the listeners
-	delete(e.listeners, eventName)
-	e.notifyLock.Unlock()
+	e.updateListeners(eventName, func([]*eventListener) []*eventListener {
+		return nil
+	})
+}
+
+// removeExpiredListeners removes the listeners for eventName that have been
+// called as many times as they asked for
+func (e *Events) removeExpiredListeners(eventName string) {
+	e.updateListeners(eventName, func(listeners []*eventListener) []*eventListener {
+		var result []*eventListener
+		for _, listener := range listeners {
+			if !listener.limited || atomic.LoadInt32(&listener.counter) > 0 {
+				result = append(result, listener)
+			}
+		}
+		return result
+	})
 }
 
 // Notify backend for the given event name
 func (e *Events) notifyBackend(eventName string, data ...interface{}) {
 
 	// Get list of event listeners
-	listeners := e.listeners[eventName]
+	listeners := e.listeners.Load().(map[string][]*eventListener)[eventName]
 	if listeners == nil {
 		e.log.Trace("No listeners for event '%s'", eventName)
 		return
 	}
 
-	// Lock the listeners
-	e.notifyLock.Lock()
-
 	// We have a dirty flag to indicate that there are items to delete
 	itemsToDelete := false
 
-	// Callback in goroutine
 	for _, listener := range listeners {
-		if listener.counter > 0 {
-			listener.counter--
+		if listener.limited {
+			remaining := atomic.AddInt32(&listener.counter, -1)
+			if remaining < 0 {
+				// Another notification used the last call
+				continue
+			}
+			if remaining == 0 {
+				itemsToDelete = true
+			}
 		}
-		go listener.callback(data...)
 
-		if listener.counter == 0 {
-			listener.delete = true
-			itemsToDelete = true
+		// Callback on a worker, or here if they are all busy
+		callback := listener.callback
+		if !e.queue(func() { callback(data...) }) {
+			callback(data...)
 		}
 	}
 
 	// Do we have items to delete?
-	if itemsToDelete == true {
+	if itemsToDelete {
+		e.removeExpiredListeners(eventName)
+	}
+}
 
-		// Create a new Listeners slice
-		var newListeners []*eventListener
+func (e *Events) Subscribe(sender frontend.Frontend, eventName string) {
+	e.updateSubscriptions(sender, func(events map[string]struct{}) {
+		events[eventName] = struct{}{}
+	})
+}
 
-		// Iterate over current listeners
-		for _, listener := range listeners {
-			// If we aren't deleting the listener, add it to the new list
-			if !listener.delete {
-				newListeners = append(newListeners, listener)
-			}
-		}
+func (e *Events) Unsubscribe(sender frontend.Frontend, eventName string) {
+	e.updateSubscriptions(sender, func(events map[string]struct{}) {
+		delete(events, eventName)
+	})
+}
 
-		// Save new listeners or remove entry
-		if len(newListeners) > 0 {
-			e.listeners[eventName] = newListeners
-		} else {
-			delete(e.listeners, eventName)
-		}
+// updateSubscriptions applies update to a copy of the subscriptions of sender
+func (e *Events) updateSubscriptions(sender frontend.Frontend, update func(map[string]struct{})) {
+	e.subscriptionsLock.Lock()
+	defer e.subscriptionsLock.Unlock()
+
+	current := e.subscriptions.Load().(map[frontend.Frontend]map[string]struct{})
+	updated := make(map[frontend.Frontend]map[string]struct{}, len(current)+1)
+	for thisFrontend, events := range current {
+		updated[thisFrontend] = events
 	}
+	events := make(map[string]struct{}, len(current[sender])+1)
+	for eventName := range current[sender] {
+		events[eventName] = struct{}{}
+	}
+	update(events)
+	updated[sender] = events
+	e.subscriptions.Store(updated)
+}
 
-	// Unlock
-	e.notifyLock.Unlock()
+// subscribed returns true if the page in appFrontend listens for eventName
+func (e *Events) subscribed(appFrontend frontend.Frontend, eventName string) bool {
+	if _, ok := appFrontend.(frontend.MultiPageFrontend); ok {
+		return true
+	}
+	_, ok := e.subscriptions.Load().(map[frontend.Frontend]map[string]struct{})[appFrontend][eventName]
+	return ok
+}
+
+func (e *Events) SetPolicy(eventName string, policy frontend.EventPolicy) {
+	e.policiesLock.Lock()
+	defer e.policiesLock.Unlock()
+
+	current := e.policies.Load().(map[string]*eventPolicy)
+	updated := make(map[string]*eventPolicy, len(current)+1)
+	for name, thisPolicy := range current {
+		updated[name] = thisPolicy
+	}
+	if policy.Delivery == frontend.DeliverEvery {
+		delete(updated, eventName)
+	} else {
+		updated[eventName] = newEventPolicy(policy, func(data ...interface{}) {
+			e.notifyFrontends(eventName, data...)
+		})
+	}
+	e.policies.Store(updated)
+}
+
+func (e *Events) PolicyStats(eventName string) frontend.EventPolicyStats {
+	policy := e.policies.Load().(map[string]*eventPolicy)[eventName]
+	if policy == nil {
+		return frontend.EventPolicyStats{}
+	}
+	return policy.stats()
 }
 
 func (e *Events) AddFrontend(appFrontend frontend.Frontend) {
@@ -0,0 +1,228 @@
+package runtime
+
+import (
+	"encoding/json"
+	"strconv"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/wailsapp/wails/v2/internal/frontend"
+	"github.com/wailsapp/wails/v2/internal/frontend/desktop/common"
+	"github.com/wailsapp/wails/v2/internal/logger"
+)
+
+// testFrontend records the events it is notified of. Like the desktop
+// frontends, it encodes them into a script for the page.
+type testFrontend struct {
+	frontend.Frontend
+	lock     sync.Mutex
+	notified []string
+	data     [][]interface{}
+	script   string
+	sent     int // Bytes of script
+}
+
+func (t *testFrontend) Notify(name string, data ...interface{}) {
+	payload, _ := json.Marshal(struct {
+		Name string        `json:"name"`
+		Data []interface{} `json:"data"`
+	}{name, data})
+	t.lock.Lock()
+	defer t.lock.Unlock()
+	t.script = `window.wails.EventsNotify('` + common.EscapeJSString(string(payload)) + `');`
+	t.sent += len(t.script)
+	t.notified = append(t.notified, name)
+	t.data = append(t.data, data)
+}
+
+type testMultiPageFrontend struct {
+	testFrontend
+}
+
+func (t *testMultiPageFrontend) MultiPage() {}
+
+// waitFor polls condition until it is true or a second has passed
+func waitFor(t *testing.T, condition func() bool) {
+	t.Helper()
+	deadline := time.Now().Add(time.Second)
+	for !condition() {
+		if time.Now().After(deadline) {
+			t.Fatal("timed out")
+		}
+		time.Sleep(time.Millisecond)
+	}
+}
+
+func TestEventCounters(t *testing.T) {
+	events := NewEvents(logger.New(nil))
+
+	var on, once, multiple int32
+	events.On("test", func(...interface{}) { atomic.AddInt32(&on, 1) })
+	events.Once("test", func(...interface{}) { atomic.AddInt32(&once, 1) })
+	events.OnMultiple("test", func(...interface{}) { atomic.AddInt32(&multiple, 1) }, 3)
+
+	const emitters = 8
+	const emits = 100
+	var wg sync.WaitGroup
+	for i := 0; i < emitters; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for j := 0; j < emits; j++ {
+				events.Emit("test", j)
+			}
+		}()
+	}
+	wg.Wait()
+
+	waitFor(t, func() bool {
+		return atomic.LoadInt32(&on) == emitters*emits && atomic.LoadInt32(&once) == 1 && atomic.LoadInt32(&multiple) == 3
+	})
+	// Give any extra calls time to show up
+	time.Sleep(10 * time.Millisecond)
+	if calls := atomic.LoadInt32(&once); calls != 1 {
+		t.Errorf("Once listener called %d times", calls)
+	}
+	if calls := atomic.LoadInt32(&multiple); calls != 3 {
+		t.Errorf("OnMultiple listener called %d times", calls)
+	}
+	if listeners := events.listeners.Load().(map[string][]*eventListener)["test"]; len(listeners) != 1 {
+		t.Errorf("expected expired listeners to be removed, have %d", len(listeners))
+	}
+}
+
+func TestEventRegistryRace(t *testing.T) {
+	events := NewEvents(logger.New(nil))
+
+	var wg sync.WaitGroup
+	for i := 0; i < 8; i++ {
+		name := "event" + strconv.Itoa(i%2)
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for j := 0; j < 200; j++ {
+				switch j % 5 {
+				case 0:
+					events.On(name, func(...interface{}) {})
+				case 1:
+					events.Once(name, func(...interface{}) {})
+				case 2:
+					events.OnMultiple(name, func(...interface{}) {}, 2)
+				case 3:
+					events.Off(name)
+				default:
+					events.Emit(name, j)
+				}
+			}
+		}()
+	}
+	wg.Wait()
+
+	events.Off("event0")
+	events.Off("event1")
+	if listeners := events.listeners.Load().(map[string][]*eventListener); len(listeners) != 0 {
+		t.Errorf("expected no listeners, have %d events", len(listeners))
+	}
+}
+
+func TestSubscriptions(t *testing.T) {
+	events := NewEvents(logger.New(nil))
+	page := &testFrontend{}
+	other := &testFrontend{}
+	devServer := &testMultiPageFrontend{}
+	events.AddFrontend(page)
+	events.AddFrontend(other)
+	events.AddFrontend(devServer)
+
+	events.Subscribe(page, "a")
+	events.Subscribe(page, "b")
+	events.Subscribe(other, "b")
+	events.Emit("a")
+	events.Notify(other, "b")
+	events.Unsubscribe(page, "a")
+	events.Emit("a")
+	events.Emit("c")
+
+	check := func(name string, notified []string, expected ...string) {
+		t.Helper()
+		if strings.Join(notified, ",") != strings.Join(expected, ",") {
+			t.Errorf("%s: notified of %v, expected %v", name, notified, expected)
+		}
+	}
+	check("page", page.notified, "a", "b")
+	check("other", other.notified)
+	check("dev server", devServer.notified, "a", "b", "a", "c")
+}
+
+func TestEventsShutdown(t *testing.T) {
+	events := NewEvents(logger.New(nil))
+
+	var calls int32
+	events.On("test", func(...interface{}) {
+		time.Sleep(time.Millisecond)
+		atomic.AddInt32(&calls, 1)
+	})
+	for i := 0; i < 100; i++ {
+		events.Emit("test", i)
+	}
+
+	// Shutdown returns once the workers have called the queued listeners
+	// and exited
+	events.Shutdown()
+	if calls := atomic.LoadInt32(&calls); calls != 100 {
+		t.Errorf("expected 100 calls after shutdown, have %d", calls)
+	}
+
+	// Listeners are then called by the emitter
+	events.Emit("test")
+	if calls := atomic.LoadInt32(&calls); calls != 101 {
+		t.Errorf("expected emit after shutdown to call the listener, have %d calls", calls)
+	}
+	events.Shutdown()
+}
+
+// BenchmarkFrontendNotify emits an event that the page has no listeners for,
+// and one that it does
+func BenchmarkFrontendNotify(b *testing.B) {
+	data := map[string]interface{}{"cpu": 0.25, "memory": 1 << 30, "samples": []int{1, 2, 3, 4}}
+	for _, listeners := range []int{0, 1} {
+		b.Run(strconv.Itoa(listeners)+" listeners", func(b *testing.B) {
+			events := NewEvents(logger.New(nil))
+			page := &testFrontend{}
+			events.AddFrontend(page)
+			if listeners > 0 {
+				events.Subscribe(page, "stats")
+			}
+			b.ReportAllocs()
+			start := time.Now()
+			for i := 0; i < b.N; i++ {
+				events.Emit("stats", data)
+				page.notified = page.notified[:0]
+				page.data = page.data[:0]
+			}
+			b.ReportMetric(float64(b.N)/time.Since(start).Seconds(), "emits/s")
+		})
+	}
+}
+
+// BenchmarkNotify notifies 1000 listeners of an event
+func BenchmarkNotify(b *testing.B) {
+	events := NewEvents(logger.New(nil))
+	var called int64
+	for i := 0; i < 1000; i++ {
+		events.On("test", func(...interface{}) { atomic.AddInt64(&called, 1) })
+	}
+
+	b.ReportAllocs()
+	start := time.Now()
+	for i := 0; i < b.N; i++ {
+		events.Emit("test", i)
+	}
+	for atomic.LoadInt64(&called) != int64(b.N)*1000 {
+		time.Sleep(time.Microsecond)
+	}
+	b.ReportMetric(float64(b.N)*1000/time.Since(start).Seconds(), "callbacks/s")
+}
@@ -1 +1 @@
-(()=>{var E=Object.defineProperty;var O=e=>E(e,"__esModule",{value:!0});var W=(e,n)=>{O(e);for(var o in n)E(e,o,{get:n[o],enumerable:!0})};var g={};W(g,{LogDebug:()=>C,LogError:()=>H,LogFatal:()=>J,LogInfo:()=>D,LogLevel:()=>G,LogPrint:()=>R,LogTrace:()=>T,LogWarning:()=>B,SetLogLevel:()=>F});function w(e,n){window.WailsInvoke("L"+e+n)}function T(e){w("T",e)}function R(e){w("P",e)}function C(e){w("D",e)}function D(e){w("I",e)}function B(e){w("W",e)}function H(e){w("E",e)}function J(e){w("F",e)}function F(e){w("S",e)}var G={TRACE:1,DEBUG:2,INFO:3,WARNING:4,ERROR:5};var b=class{constructor(n,o){o=o||-1,this.Callback=i=>(n.apply(null,i),o===-1?!1:(o-=1,o===0))}},s={};function c(e,n,o){s[e]=s[e]||[];let i=new b(n,o);s[e].push(i)}function k(e,n){c(e,n,-1)}function m(e,n){c(e,n,1)}function h(e){let n=e.name;if(s[n]){let o=s[n].slice();for(let i=0;i<s[n].length;i+=1){let t=s[n][i],r=e.data;t.Callback(r)&&o.splice(i,1)}s[n]=o}}function I(e){let n;try{n=JSON.parse(e)}catch(o){let i="Invalid JSON passed to Notify: "+e;throw new Error(i)}h(n)}function y(e){let n={name:e,data:[].slice.apply(arguments).slice(1)};h(n),window.WailsInvoke("EE"+JSON.stringify(n))}function S(e){delete s[e],window.WailsInvoke("EX"+e)}var a={};function U(){var e=new Uint32Array(1);return window.crypto.getRandomValues(e)[0]}function A(){return Math.random()*9007199254740991}var p;window.crypto?p=U:p=A;function f(e,n,o){return o==null&&(o=0),new Promise(function(i,t){var r;do r=e+"-"+p();while(a[r]);var d;o>0&&(d=setTimeout(function(){t(Error("Call to "+e+" timed out. Request ID: "+r))},o)),a[r]={timeoutHandle:d,reject:t,resolve:i};try{let u={name:e,args:n,callbackID:r};window.WailsInvoke("C"+JSON.stringify(u))}catch(u){console.error(u)}})}function L(e){let n;try{n=JSON.parse(e)}catch(t){let r=`Invalid JSON passed to callback: ${t.message}. Message: ${e}`;throw runtime.LogDebug(r),new Error(r)}let o=n.callbackid,i=a[o];if(!i){let t=`Callback '${o}' not registered!!!`;throw console.error(t),new Error(t)}clearTimeout(i.timeoutHandle),delete a[o],n.error?i.reject(n.error):i.resolve(n.result)}window.go={};function z(e){try{e=JSON.parse(e)}catch(n){console.error(n)}window.go=window.go||{},Object.keys(e).forEach(n=>{window.go[n]=window.go[n]||{},Object.keys(e[n]).forEach(o=>{window.go[n][o]=window.go[n][o]||{},Object.keys(e[n][o]).forEach(i=>{window.go[n][o][i]=function(){let t=0;function r(){let d=[].slice.call(arguments);return f([n,o,i].join("."),d,t)}return r.setTimeout=function(d){t=d},r.getTimeout=function(){return t},r}()})})})}var v={};W(v,{WindowCenter:()=>P,WindowFullscreen:()=>X,WindowGetPosition:()=>Z,WindowGetSize:()=>Q,WindowHide:()=>K,WindowMaximise:()=>ee,WindowMinimise:()=>oe,WindowReload:()=>M,WindowSetMaxSize:()=>V,WindowSetMinSize:()=>q,WindowSetPosition:()=>N,WindowSetRGBA:()=>te,WindowSetSize:()=>$,WindowSetTitle:()=>j,WindowShow:()=>_,WindowUnFullscreen:()=>Y,WindowUnmaximise:()=>ne,WindowUnminimise:()=>ie});function M(){window.location.reload()}function P(){window.WailsInvoke("Wc")}function j(e){window.WailsInvoke("WT"+e)}function X(){window.WailsInvoke("WF")}function Y(){window.WailsInvoke("Wf")}function $(e,n){window.WailsInvoke("Ws:"+e+":"+n)}function Q(){return f(":wails:WindowGetSize")}function V(e,n){window.WailsInvoke("WZ:"+e+":"+n)}function q(e,n){window.WailsInvoke("Wz:"+e+":"+n)}function N(e,n){window.WailsInvoke("Wp:"+e+":"+n)}function Z(){return f(":wails:WindowGetPos")}function K(){window.WailsInvoke("WH")}function _(){window.WailsInvoke("WS")}function ee(){window.WailsInvoke("WM")}function ne(){window.WailsInvoke("WU")}function oe(){window.WailsInvoke("Wm")}function ie(){window.WailsInvoke("Wu")}function te(e){let n=JSON.stringify(e);window.WailsInvoke("Wr:"+n)}var x={};W(x,{BrowserOpenURL:()=>re});function re(e){window.WailsInvoke("BO:"+e)}function se(){window.WailsInvoke("Q")}window.runtime={...g,...v,...x,EventsOn:k,EventsOnce:m,EventsOnMultiple:c,EventsEmit:y,EventsOff:S,Quit:se};window.wails={Callback:L,EventsNotify:I,SetBindings:z,eventListeners:s,callbacks:a,flags:{disableScrollbarDrag:!1,disableWailsDefaultContextMenu:!1,enableResize:!1,defaultCursor:null,borderThickness:6}};window.wails.SetBindings(window.wailsbindings);delete window.wails.SetBindings;window.addEventListener("mousedown",e=>{if(window.wails.flags.resizeEdge){window.WailsInvoke("resize:"+window.wails.flags.resizeEdge),e.preventDefault();return}let n=e.target;for(;n!=null&&!n.hasAttribute("data-wails-no-drag");){if(n.hasAttribute("data-wails-drag")){if(window.wails.flags.disableScrollbarDrag&&(e.offsetX>e.target.clientWidth||e.offsetY>e.target.clientHeight))break;window.WailsInvoke("drag"),e.preventDefault();break}n=n.parentElement}});function l(e){document.body.style.cursor=e||window.wails.flags.defaultCursor,window.wails.flags.resizeEdge=e}window.addEventListener("mousemove",function(e){if(!window.wails.flags.enableResize)return;window.wails.flags.defaultCursor==null&&(window.wails.flags.defaultCursor=document.body.style.cursor),window.outerWidth-e.clientX<window.wails.flags.borderThickness&&window.outerHeight-e.clientY<window.wails.flags.borderThickness&&(document.body.style.cursor="se-resize");let n=window.outerWidth-e.clientX<window.wails.flags.borderThickness,o=e.clientX<window.wails.flags.borderThickness,i=e.clientY<window.wails.flags.borderThickness,t=window.outerHeight-e.clientY<window.wails.flags.borderThickness;!o&&!n&&!i&&!t&&window.wails.flags.resizeEdge!==void 0?l():n&&t?l("se-resize"):o&&t?l("sw-resize"):o&&i?l("nw-resize"):i&&n?l("ne-resize"):o?l("w-resize"):i?l("n-resize"):t?l("s-resize"):n&&l("e-resize")});window.addEventListener("contextmenu",function(e){window.wails.flags.disableWailsDefaultContextMenu&&e.preventDefault()});})();
+(()=>{var E=Object.defineProperty;var O=e=>E(e,"__esModule",{value:!0});var W=(e,n)=>{O(e);for(var o in n)E(e,o,{get:n[o],enumerable:!0})};var g={};W(g,{LogDebug:()=>C,LogError:()=>H,LogFatal:()=>J,LogInfo:()=>D,LogLevel:()=>G,LogPrint:()=>R,LogTrace:()=>T,LogWarning:()=>B,SetLogLevel:()=>F});function w(e,n){window.WailsInvoke("L"+e+n)}function T(e){w("T",e)}function R(e){w("P",e)}function C(e){w("D",e)}function D(e){w("I",e)}function B(e){w("W",e)}function H(e){w("E",e)}function J(e){w("F",e)}function F(e){w("S",e)}var G={TRACE:1,DEBUG:2,INFO:3,WARNING:4,ERROR:5};function ce(){return!!(window.wailsipc&&window.wailsipc.compact)}function le(e){let n="";for(;e>=32;)n+=String.fromCharCode(96|e%32),e=Math.floor(e/32);return n+String.fromCharCode(64|e)}function ue(e,n,o,i){let t=i?le(i):le(0)+n;return"\x01"+le(e)+t+"\x1F"+(o?JSON.stringify(o):"")}function de(e,n){return e.indexOf("\x1F")!==-1?null:"\x02"+e+"\x1F"+JSON.stringify(n)}var b=class{constructor(n,o){o=o||-1,this.Callback=i=>(n.apply(null,i),o===-1?!1:(o-=1,o===0))}},s={};function c(e,n,o){s[e]=s[e]||[];s[e].length===0&&window.WailsInvoke("EO"+e);let i=new b(n,o);s[e].push(i)}function k(e,n){c(e,n,-1)}function m(e,n){c(e,n,1)}function h(e){let n=e.name;if(s[n]){let o=s[n].slice();for(let i=0;i<s[n].length;i+=1){let t=s[n][i],r=e.data;t.Callback(r)&&o.splice(i,1)}s[n]=o}}function I(e){let n;try{n=JSON.parse(e)}catch(o){let i="Invalid JSON passed to Notify: "+e;throw new Error(i)}h(n)}function y(e){let n={name:e,data:[].slice.apply(arguments).slice(1)};h(n);let o=ce()?de(n.name,n.data):null;window.WailsInvoke(o!==null?o:"EE"+JSON.stringify(n))}function S(e){delete s[e],window.WailsInvoke("EX"+e)}var a={},fe=1;function U(){var e=new Uint32Array(1);return window.crypto.getRandomValues(e)[0]}function A(){return Math.random()*9007199254740991}var p;window.crypto?p=U:p=A;function f(e,n,o,ae){return o==null&&(o=0),new Promise(function(i,t){var u=ce(),r;if(u)r=fe++;else do r=e+"-"+p();while(a[r]);var d;o>0&&(d=setTimeout(function(){t(Error("Call to "+e+" timed out. Request ID: "+r))},o)),a[r]={timeoutHandle:d,reject:t,resolve:i};try{u?window.WailsInvoke(ue(r,e,n,ae)):window.WailsInvoke("C"+JSON.stringify({name:e,args:n,callbackID:r}))}catch(g){console.error(g)}})}function L(e){let n;try{n=JSON.parse(e)}catch(t){let r=`Invalid JSON passed to callback: ${t.message}. Message: ${e}`;throw runtime.LogDebug(r),new Error(r)}let o=n.callbackid,i=a[o];if(!i){let t=`Callback '${o}' not registered!!!`;throw console.error(t),new Error(t)}clearTimeout(i.timeoutHandle),delete a[o],n.error?i.reject(n.error):i.resolve(n.result)}window.go={};function z(e){try{e=JSON.parse(e)}catch(n){console.error(n)}window.go=window.go||{},Object.keys(e).forEach(n=>{window.go[n]=window.go[n]||{},Object.keys(e[n]).forEach(o=>{window.go[n][o]=window.go[n][o]||{},Object.keys(e[n][o]).forEach(i=>{let ae=e[n][o][i].id;window.go[n][o][i]=function(){let t=0;function r(){let d=[].slice.call(arguments);return f([n,o,i].join("."),d,t,ae)}return r.setTimeout=function(d){t=d},r.getTimeout=function(){return t},r}()})})})}var v={};W(v,{WindowCenter:()=>P,WindowFullscreen:()=>X,WindowGetPosition:()=>Z,WindowGetSize:()=>Q,WindowHide:()=>K,WindowMaximise:()=>ee,WindowMinimise:()=>oe,WindowReload:()=>M,WindowSetMaxSize:()=>V,WindowSetMinSize:()=>q,WindowSetPosition:()=>N,WindowSetRGBA:()=>te,WindowSetSize:()=>$,WindowSetTitle:()=>j,WindowShow:()=>_,WindowUnFullscreen:()=>Y,WindowUnmaximise:()=>ne,WindowUnminimise:()=>ie});function M(){window.location.reload()}function P(){window.WailsInvoke("Wc")}function j(e){window.WailsInvoke("WT"+e)}function X(){window.WailsInvoke("WF")}function Y(){window.WailsInvoke("Wf")}function $(e,n){window.WailsInvoke("Ws:"+e+":"+n)}function Q(){return f(":wails:WindowGetSize")}function V(e,n){window.WailsInvoke("WZ:"+e+":"+n)}function q(e,n){window.WailsInvoke("Wz:"+e+":"+n)}function N(e,n){window.WailsInvoke("Wp:"+e+":"+n)}function Z(){return f(":wails:WindowGetPos")}function K(){window.WailsInvoke("WH")}function _(){window.WailsInvoke("WS")}function ee(){window.WailsInvoke("WM")}function ne(){window.WailsInvoke("WU")}function oe(){window.WailsInvoke("Wm")}function ie(){window.WailsInvoke("Wu")}function te(e){let n=JSON.stringify(e);window.WailsInvoke("Wr:"+n)}var x={};W(x,{BrowserOpenURL:()=>re});function re(e){window.WailsInvoke("BO:"+e)}function se(){window.WailsInvoke("Q")}window.runtime={...g,...v,...x,EventsOn:k,EventsOnce:m,EventsOnMultiple:c,EventsEmit:y,EventsOff:S,Quit:se};window.wails={Callback:L,EventsNotify:I,SetBindings:z,eventListeners:s,callbacks:a,flags:{disableScrollbarDrag:!1,disableWailsDefaultContextMenu:!1,enableResize:!1,defaultCursor:null,borderThickness:6}};window.wails.SetBindings(window.wailsbindings);delete window.wails.SetBindings;window.addEventListener("mousedown",e=>{if(window.wails.flags.resizeEdge){window.WailsInvoke("resize:"+window.wails.flags.resizeEdge),e.preventDefault();return}let n=e.target;for(;n!=null&&!n.hasAttribute("data-wails-no-drag");){if(n.hasAttribute("data-wails-drag")){if(window.wails.flags.disableScrollbarDrag&&(e.offsetX>e.target.clientWidth||e.offsetY>e.target.clientHeight))break;window.WailsInvoke("drag"),e.preventDefault();break}n=n.parentElement}});function l(e){document.body.style.cursor=e||window.wails.flags.defaultCursor,window.wails.flags.resizeEdge=e}window.addEventListener("mousemove",function(e){if(!window.wails.flags.enableResize)return;window.wails.flags.defaultCursor==null&&(window.wails.flags.defaultCursor=document.body.style.cursor),window.outerWidth-e.clientX<window.wails.flags.borderThickness&&window.outerHeight-e.clientY<window.wails.flags.borderThickness&&(document.body.style.cursor="se-resize");let n=window.outerWidth-e.clientX<window.wails.flags.borderThickness,o=e.clientX<window.wails.flags.borderThickness,i=e.clientY<window.wails.flags.borderThickness,t=window.outerHeight-e.clientY<window.wails.flags.borderThickness;!o&&!n&&!i&&!t&&window.wails.flags.resizeEdge!==void 0?l():n&&t?l("se-resize"):o&&t?l("sw-resize"):o&&i?l("nw-resize"):i&&n?l("ne-resize"):o?l("w-resize"):i?l("n-resize"):t?l("s-resize"):n&&l("e-resize")});window.addEventListener("contextmenu",function(e){window.wails.flags.disableWailsDefaultContextMenu&&e.preventDefault()});})();
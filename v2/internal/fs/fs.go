@@ -2,6 +2,7 @@ package fs
 
 import (
 	"crypto/md5"
+	"encoding/binary"
 	"fmt"
 	"io"
 	"io/fs"
@@ -171,6 +172,56 @@ func MustWriteString(filename string, data string) {
 	}
 }
 
+// generatedHashPrefix starts the first line of files written by WriteGeneratedFile
+const generatedHashPrefix = "// inputs: "
+
+// HashInputs returns the md5sum of the given inputs. Each input is length
+// prefixed so that moving bytes from one input to the next changes the hash.
+func HashInputs(inputs ...[]byte) string {
+	h := md5.New()
+	var length [8]byte
+	for _, input := range inputs {
+		binary.LittleEndian.PutUint64(length[:], uint64(len(input)))
+		h.Write(length[:])
+		h.Write(input)
+	}
+	return fmt.Sprintf("%x", h.Sum(nil))
+}
+
+// GeneratedFileIsCurrent returns true if the given file was written by
+// WriteGeneratedFile from inputs with the given hash
+func GeneratedFileIsCurrent(filename string, inputsHash string) bool {
+	f, err := os.Open(filename)
+	if err != nil {
+		return false
+	}
+	defer f.Close()
+
+	expected := generatedHashPrefix + inputsHash + "\n"
+	firstLine := make([]byte, len(expected))
+	if _, err := io.ReadFull(f, firstLine); err != nil {
+		return false
+	}
+	return string(firstLine) == expected
+}
+
+// WriteGeneratedFile writes data to the given file, preceded by a comment
+// recording the hash of the inputs it was generated from
+func WriteGeneratedFile(filename string, inputsHash string, data []byte, perm os.FileMode) error {
+	f, err := os.OpenFile(filename, os.O_WRONLY|os.O_CREATE|os.O_TRUNC, perm)
+	if err != nil {
+		return err
+	}
+	_, err = f.WriteString(generatedHashPrefix + inputsHash + "\n")
+	if err == nil {
+		_, err = f.Write(data)
+	}
+	if closeErr := f.Close(); err == nil {
+		err = closeErr
+	}
+	return err
+}
+
 // fatal will print the optional messages and die
 func fatal(message ...string) {
 	if len(message) > 0 {
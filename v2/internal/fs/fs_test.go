@@ -29,3 +29,20 @@ func TestRelativePath(t *testing.T) {
 	is.Equal(actual, expected)
 
 }
+
+func TestGeneratedFile(t *testing.T) {
+	is := is.New(t)
+
+	filename := filepath.Join(t.TempDir(), "generated.h")
+	hash := HashInputs([]byte("icon"), []byte("data"))
+	is.True(hash != HashInputs([]byte("icond"), []byte("ata")))
+	is.True(!GeneratedFileIsCurrent(filename, hash))
+
+	is.NoErr(WriteGeneratedFile(filename, hash, []byte("const int x = 1;\n"), 0600))
+	is.True(GeneratedFileIsCurrent(filename, hash))
+	is.True(!GeneratedFileIsCurrent(filename, HashInputs([]byte("other"))))
+
+	data, err := os.ReadFile(filename)
+	is.NoErr(err)
+	is.Equal(string(data), "// inputs: "+hash+"\nconst int x = 1;\n")
+}
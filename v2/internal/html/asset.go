@@ -12,6 +12,7 @@ import (
 
 	"github.com/tdewolff/minify"
 	"github.com/tdewolff/minify/js"
+	"github.com/wailsapp/wails/v2/internal/cbytes"
 )
 
 type assetTypes struct {
@@ -101,25 +102,23 @@ func (a *Asset) minifiedData() (string, error) {
 
 // AsCHexData processes the asset data so it may be used by C
 func (a *Asset) AsCHexData() string {
-	dataString, err := a.minifiedData()
+	result, err := a.asCData()
 	if err != nil {
 		log.Fatal(err)
 	}
-	// Get byte data of the string
-	bytes := *(*[]byte)(unsafe.Pointer(&dataString))
-
-	// Create a strings builder
-	var cdata strings.Builder
-
-	// Set buffer size to 4k
-	cdata.Grow(4096)
+	return result
+}
 
-	// Convert each byte to hex
-	for _, b := range bytes {
-		cdata.WriteString(fmt.Sprintf("0x%x, ", b))
+// asCData minifies the asset and returns it as C integer literals
+func (a *Asset) asCData() (string, error) {
+	dataString, err := a.minifiedData()
+	if err != nil {
+		return "", err
 	}
+	// Get byte data of the string
+	bytes := *(*[]byte)(unsafe.Pointer(&dataString))
 
-	return cdata.String()
+	return cbytes.String(bytes), nil
 }
 
 // Dump will output the asset to the terminal
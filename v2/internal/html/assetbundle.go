@@ -4,12 +4,14 @@ import (
 	"bytes"
 	"fmt"
 	"io"
-	"os"
 	"path/filepath"
+	"runtime"
 	"strings"
+	"sync"
 
 	"github.com/leaanthony/slicer"
 	"github.com/wailsapp/wails/v2/internal/assetdb"
+	"github.com/wailsapp/wails/v2/internal/fs"
 	"golang.org/x/net/html"
 )
 
@@ -152,9 +154,60 @@ func (a *AssetBundle) processHTML(htmldata string) error {
 	return nil
 }
 
-// WriteToCFile dumps all the assets to C files in the given directory
+// assetsHeaderVersion is hashed with the assets, so that assets.h files
+// generated by an older build are regenerated. Change it when the header
+// written by WriteToCFile changes.
+const assetsHeaderVersion = "assets-1"
+
+// WriteToCFile dumps all the assets to C files in the given directory. If the
+// file is already there and was written from the same assets, it is left
+// as it is.
 func (a *AssetBundle) WriteToCFile(targetDir string) (string, error) {
 
+	assetsFile := filepath.Join(targetDir, "assets.h")
+
+	// For desktop we ignore the favicon
+	var assets []*Asset
+	var indexes []int
+	inputs := [][]byte{[]byte(assetsHeaderVersion)}
+	for index, asset := range a.assets {
+		if asset.Type == AssetTypes.FAVICON {
+			continue
+		}
+		assets = append(assets, asset)
+		indexes = append(indexes, index)
+		inputs = append(inputs, []byte(asset.Type), []byte(asset.Path), []byte(asset.Data))
+	}
+	inputsHash := fs.HashInputs(inputs...)
+	if fs.GeneratedFileIsCurrent(assetsFile, inputsHash) {
+		return assetsFile, nil
+	}
+
+	// Minifying and encoding is slow so is done in parallel
+	encoded := make([]string, len(assets))
+	errs := make([]error, len(assets))
+	next := make(chan int)
+	var wg sync.WaitGroup
+	for worker := 0; worker < runtime.NumCPU(); worker++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for index := range next {
+				encoded[index], errs[index] = assets[index].asCData()
+			}
+		}()
+	}
+	for index := range assets {
+		next <- index
+	}
+	close(next)
+	wg.Wait()
+	for _, err := range errs {
+		if err != nil {
+			return "", err
+		}
+	}
+
 	// Write out the assets.c file
 	var cdata strings.Builder
 
@@ -164,20 +217,20 @@ func (a *AssetBundle) WriteToCFile(targetDir string) (string, error) {
 // This file was auto-generated. DO NOT MODIFY.
 
 `
+	size := len(header) + 64
+	for _, data := range encoded {
+		size += len(data) + 64
+	}
+	cdata.Grow(size)
 	cdata.WriteString(header)
 
 	// Loop over the Assets
-	var err error
 	assetVariables := slicer.String()
-	var variableName string
-	for index, asset := range a.assets {
-		// For desktop we ignore the favicon
-		if asset.Type == AssetTypes.FAVICON {
-			continue
-		}
-		variableName = fmt.Sprintf("%s%d", asset.Type, index)
-		assetCdata := fmt.Sprintf("const unsigned char %s[]={ %s0x00 };\n", variableName, asset.AsCHexData())
-		cdata.WriteString(assetCdata)
+	for index, asset := range assets {
+		variableName := fmt.Sprintf("%s%d", asset.Type, indexes[index])
+		cdata.WriteString("const unsigned char " + variableName + "[]={ ")
+		cdata.WriteString(encoded[index])
+		cdata.WriteString("0x00 };\n")
 		assetVariables.Add(variableName)
 	}
 
@@ -188,8 +241,7 @@ func (a *AssetBundle) WriteToCFile(targetDir string) (string, error) {
 	}
 
 	// Save file
-	assetsFile := filepath.Join(targetDir, "assets.h")
-	err = os.WriteFile(assetsFile, []byte(cdata.String()), 0600)
+	err := fs.WriteGeneratedFile(assetsFile, inputsHash, []byte(cdata.String()), 0600)
 	if err != nil {
 		return "", err
 	}
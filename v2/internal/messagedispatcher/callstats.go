@@ -0,0 +1,127 @@
+package messagedispatcher
+
+import (
+	"sort"
+	"strings"
+	"sync"
+	"time"
+)
+
+// The number of recent call latencies kept for percentiles
+const latencySamples = 1024
+
+// CallStats times a client's calls. Results are matched to calls by their
+// callback ID.
+type CallStats struct {
+	lock      sync.Mutex
+	started   map[string]time.Time
+	latencies []time.Duration
+	next      int
+}
+
+func newCallStats() *CallStats {
+	return &CallStats{
+		started:   make(map[string]time.Time),
+		latencies: make([]time.Duration, 0, latencySamples),
+	}
+}
+
+// callStarted records the start of the call with the given callback ID
+func (c *CallStats) callStarted(callbackID string) {
+	if callbackID == "" {
+		return
+	}
+	c.lock.Lock()
+	c.started[callbackID] = time.Now()
+	c.lock.Unlock()
+}
+
+// callFinished records the end of the call the given result is for
+func (c *CallStats) callFinished(result string) {
+	callbackID := resultCallbackID(result)
+	if callbackID == "" {
+		return
+	}
+	c.lock.Lock()
+	defer c.lock.Unlock()
+	start, ok := c.started[callbackID]
+	if !ok {
+		return
+	}
+	delete(c.started, callbackID)
+	latency := time.Since(start)
+	if len(c.latencies) < latencySamples {
+		c.latencies = append(c.latencies, latency)
+		return
+	}
+	c.latencies[c.next] = latency
+	c.next = (c.next + 1) % latencySamples
+}
+
+// resultCallbackID returns the callback ID of a call result. The result is
+// a subsystem.CallbackMessage, which ends with the callback ID.
+func resultCallbackID(result string) string {
+	const key = `"callbackid":"`
+	start := strings.LastIndex(result, key)
+	if start == -1 {
+		return ""
+	}
+	start += len(key)
+	end := strings.IndexByte(result[start:], '"')
+	if end == -1 {
+		return ""
+	}
+	return result[start : start+end]
+}
+
+// InFlight returns the number of calls waiting for a result
+func (c *CallStats) InFlight() int {
+	c.lock.Lock()
+	defer c.lock.Unlock()
+	return len(c.started)
+}
+
+// Latency returns the given percentile, eg: 99, of the latencies of recent
+// calls
+func (c *CallStats) Latency(percentile float64) time.Duration {
+	return percentileOf(c.sortedLatencies(), percentile)
+}
+
+func (c *CallStats) sortedLatencies() []time.Duration {
+	c.lock.Lock()
+	result := append([]time.Duration(nil), c.latencies...)
+	c.lock.Unlock()
+	sort.Slice(result, func(i, j int) bool { return result[i] < result[j] })
+	return result
+}
+
+func percentileOf(sorted []time.Duration, percentile float64) time.Duration {
+	if len(sorted) == 0 {
+		return 0
+	}
+	index := int(percentile / 100 * float64(len(sorted)))
+	if index >= len(sorted) {
+		index = len(sorted) - 1
+	}
+	return sorted[index]
+}
+
+// SessionStats describes the calls of a frontend session
+type SessionStats struct {
+	InFlight int           // Calls waiting for a result
+	P50      time.Duration // Latencies of recent calls
+	P90      time.Duration
+	P99      time.Duration
+}
+
+// SessionStats returns the number of calls in flight and the latency
+// percentiles of recent calls
+func (c *CallStats) SessionStats() SessionStats {
+	latencies := c.sortedLatencies()
+	return SessionStats{
+		InFlight: c.InFlight(),
+		P50:      percentileOf(latencies, 50),
+		P90:      percentileOf(latencies, 90),
+		P99:      percentileOf(latencies, 99),
+	}
+}
@@ -0,0 +1,152 @@
+package messagedispatcher
+
+import (
+	"context"
+	"strconv"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/matryer/is"
+	"github.com/wailsapp/wails/v2/internal/binding"
+	"github.com/wailsapp/wails/v2/internal/logger"
+	"github.com/wailsapp/wails/v2/internal/servicebus"
+	"github.com/wailsapp/wails/v2/internal/subsystem"
+)
+
+func TestResultCallbackID(t *testing.T) {
+	is := is.New(t)
+
+	is.Equal(resultCallbackID(`{"result":"ok","error":"","callbackid":"main.App.Greet-123"}`), "main.App.Greet-123")
+	is.Equal(resultCallbackID(`{"result":{"callbackid":"inner"},"error":"","callbackid":"outer"}`), "outer")
+	is.Equal(resultCallbackID(`{"result":"ok","error":""}`), "")
+}
+
+func TestCallStats(t *testing.T) {
+	is := is.New(t)
+
+	stats := newCallStats()
+	for i := 0; i < 100; i++ {
+		stats.callStarted(strconv.Itoa(i))
+	}
+	is.Equal(stats.InFlight(), 100)
+
+	for i := 0; i < 100; i++ {
+		stats.callFinished(`{"result":null,"error":"","callbackid":"` + strconv.Itoa(i) + `"}`)
+	}
+	// Unknown results are ignored
+	stats.callFinished(`{"result":null,"error":"","callbackid":"unknown"}`)
+	is.Equal(stats.InFlight(), 0)
+	is.Equal(len(stats.latencies), 100)
+	is.True(stats.Latency(50) <= stats.Latency(99))
+
+	// Only the recent latencies are kept
+	for i := 0; i < 2*latencySamples; i++ {
+		stats.callStarted("call")
+		stats.callFinished(`{"callbackid":"call"}`)
+	}
+	is.Equal(len(stats.latencies), latencySamples)
+
+	session := stats.SessionStats()
+	is.Equal(session.InFlight, 0)
+	is.True(session.P50 <= session.P90 && session.P90 <= session.P99)
+}
+
+// BenchApp is bound for BenchmarkCalls
+type BenchApp struct{}
+
+// Fetch stands in for a method that waits on IO
+func (b *BenchApp) Fetch(id int) int {
+	time.Sleep(time.Millisecond)
+	return id
+}
+
+// benchClient is a frontend that matches call results to its calls by
+// callback ID
+type benchClient struct {
+	Client
+	lock    sync.Mutex
+	waiting map[string]chan struct{}
+}
+
+func (b *benchClient) CallResult(message string) {
+	callbackID := resultCallbackID(message)
+	b.lock.Lock()
+	done := b.waiting[callbackID]
+	delete(b.waiting, callbackID)
+	b.lock.Unlock()
+	if done != nil {
+		close(done)
+	}
+}
+
+func (b *benchClient) call(dispatcher *DispatchClient, callbackID string, id int) {
+	done := make(chan struct{})
+	b.lock.Lock()
+	b.waiting[callbackID] = done
+	b.lock.Unlock()
+	dispatcher.DispatchMessage(`C{"name":"messagedispatcher.BenchApp.Fetch","args":[` + strconv.Itoa(id) + `],"callbackID":"` + callbackID + `"}`)
+	<-done
+}
+
+// BenchmarkCalls pipelines calls to a method that takes 1ms, as a frontend
+// does, and reports the call latencies. Run with -benchtime 100000x for 100k
+// calls.
+func BenchmarkCalls(b *testing.B) {
+	log := logger.New(nil)
+	bus := servicebus.New(log)
+	dispatcher, err := New(bus, log)
+	if err != nil {
+		b.Fatal(err)
+	}
+	bindings := binding.NewBindings(log, []interface{}{&BenchApp{}}, nil)
+	var wg sync.WaitGroup
+	ctx, cancel := context.WithCancel(context.WithValue(context.Background(), "waitgroup", &wg))
+	call, err := subsystem.NewCall(ctx, bus, log, bindings.DB())
+	if err != nil {
+		b.Fatal(err)
+	}
+	if err := bus.Start(); err != nil {
+		b.Fatal(err)
+	}
+	if err := dispatcher.Start(); err != nil {
+		b.Fatal(err)
+	}
+	if err := call.Start(); err != nil {
+		b.Fatal(err)
+	}
+	defer func() {
+		cancel()
+		dispatcher.Close()
+		bus.Stop()
+	}()
+
+	client := &benchClient{waiting: make(map[string]chan struct{})}
+	dispatchClient := dispatcher.RegisterClient(client)
+
+	// The frontend doesn't wait for a result before making its next call
+	const pipelined = 64
+	calls := make(chan int)
+	var callers sync.WaitGroup
+	for i := 0; i < pipelined; i++ {
+		callers.Add(1)
+		go func() {
+			defer callers.Done()
+			for id := range calls {
+				client.call(dispatchClient, "Fetch-"+strconv.Itoa(id), id)
+			}
+		}()
+	}
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		calls <- i
+	}
+	close(calls)
+	callers.Wait()
+	b.StopTimer()
+
+	stats := dispatchClient.Stats().SessionStats()
+	b.ReportMetric(float64(stats.P50.Microseconds()), "p50-µs")
+	b.ReportMetric(float64(stats.P99.Microseconds()), "p99-µs")
+}
@@ -52,6 +52,9 @@ type DispatchClient struct {
 
 	// Client
 	frontend Client
+
+	// Call timings
+	stats *CallStats
 }
 
 func newDispatchClient(id string, frontend Client, logger logger.CustomLogger, bus *servicebus.ServiceBus) *DispatchClient {
@@ -61,6 +64,7 @@ func newDispatchClient(id string, frontend Client, logger logger.CustomLogger, b
 		frontend: frontend,
 		logger:   logger,
 		bus:      bus,
+		stats:    newCallStats(),
 	}
 
 }
@@ -81,9 +85,18 @@ func (d *DispatchClient) DispatchMessage(incomingMessage string) {
 	// Save this client id
 	parsedMessage.ClientID = d.id
 
+	if call, ok := parsedMessage.Data.(*message.CallMessage); ok {
+		d.stats.callStarted(call.CallbackID)
+	}
+
 	d.logger.Trace("I got a parsedMessage: %+v", parsedMessage)
 
 	// Publish the parsed message
 	d.bus.PublishForTarget(parsedMessage.Topic, parsedMessage.Data, d.id)
 
 }
+
+// Stats returns the timings of the client's calls
+func (d *DispatchClient) Stats() *CallStats {
+	return d.stats
+}
@@ -198,6 +198,7 @@ func (d *Dispatcher) processCallResult(result *servicebus.Message) {
 	}
 
 	d.logger.Trace("Sending message to client %s: R%s", target, result.Data().(string))
+	client.stats.callFinished(result.Data().(string))
 	client.frontend.CallResult(result.Data().(string))
 }
 
@@ -0,0 +1,120 @@
+package servicebus
+
+import "sync/atomic"
+
+// Subscriptions are prefixes of the topics they receive: a subscription to
+// "runtime:" receives "runtime:events:emit". They are held in a trie keyed by
+// the bytes of the topic, so finding the subscribers for a message is a walk
+// down the message's topic rather than a comparison against every topic.
+
+// maxCachedRoutes is the number of concrete topics the routing cache holds
+// before it is reset
+const maxCachedRoutes = 1024
+
+// OverflowPolicy decides what happens to a message when a subscriber's
+// queue is full
+type OverflowPolicy int
+
+const (
+	// Block waits until the subscriber has room. Nothing is lost but a slow
+	// subscriber holds up delivery to every other subscriber.
+	Block OverflowPolicy = iota
+
+	// DropNewest drops the message that didn't fit
+	DropNewest
+
+	// DropOldest drops the oldest queued message to make room
+	DropOldest
+)
+
+type subscriber struct {
+	channel chan *Message
+	policy  OverflowPolicy
+}
+
+type topicNode struct {
+	children    map[byte]*topicNode
+	subscribers []*subscriber
+}
+
+// add adds the subscriber to the node for topic, creating it if needed
+func (n *topicNode) add(topic string, sub *subscriber) {
+	for i := 0; i < len(topic); i++ {
+		child := n.children[topic[i]]
+		if child == nil {
+			if n.children == nil {
+				n.children = make(map[byte]*topicNode)
+			}
+			child = &topicNode{}
+			n.children[topic[i]] = child
+		}
+		n = child
+	}
+	n.subscribers = append(n.subscribers, sub)
+}
+
+// find returns the node for topic or nil if there isn't one
+func (n *topicNode) find(topic string) *topicNode {
+	for i := 0; i < len(topic) && n != nil; i++ {
+		n = n.children[topic[i]]
+	}
+	return n
+}
+
+// match appends the subscribers for every prefix of topic to result
+func (n *topicNode) match(topic string, result []*subscriber) []*subscriber {
+	result = append(result, n.subscribers...)
+	for i := 0; i < len(topic); i++ {
+		n = n.children[topic[i]]
+		if n == nil {
+			break
+		}
+		result = append(result, n.subscribers...)
+	}
+	return result
+}
+
+// route returns the subscribers for the given topic. The routes for recent
+// topics are cached. It must be called with the lock held for reading, and
+// only from the dispatching goroutine, which is the only user of the cache.
+// Changes to the subscriptions reset the cache with the lock held for writing.
+func (s *ServiceBus) route(topic string) []*subscriber {
+	if subscribers, ok := s.routes[topic]; ok {
+		return subscribers
+	}
+	if s.routes == nil || len(s.routes) >= maxCachedRoutes {
+		s.routes = make(map[string][]*subscriber)
+	}
+	subscribers := s.subscriptions.match(topic, nil)
+	s.routes[topic] = subscribers
+	return subscribers
+}
+
+// deliver sends the message to the subscriber, applying its overflow policy
+// if its queue is full
+func (s *ServiceBus) deliver(sub *subscriber, message *Message) {
+	select {
+	case sub.channel <- message:
+		return
+	default:
+	}
+
+	switch sub.policy {
+	case DropNewest:
+	case DropOldest:
+		select {
+		case <-sub.channel:
+			atomic.AddUint64(&s.dropped, 1)
+		default:
+		}
+		select {
+		case sub.channel <- message:
+			return
+		default:
+		}
+	default:
+		sub.channel <- message
+		return
+	}
+	atomic.AddUint64(&s.dropped, 1)
+}
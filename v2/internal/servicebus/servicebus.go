@@ -3,15 +3,19 @@ package servicebus
 import (
 	"context"
 	"fmt"
-	"strings"
 	"sync"
+	"sync/atomic"
 
 	"github.com/wailsapp/wails/v2/internal/logger"
 )
 
 // ServiceBus is a messaging bus for Wails applications
 type ServiceBus struct {
-	listeners    map[string][]chan *Message
+	// The number of messages dropped by the overflow policies. Accessed
+	// atomically so kept first for 64 bit alignment on 32 bit platforms.
+	dropped uint64
+
+	listeners    map[string][]*subscriber
 	messageQueue chan *Message
 	lock         sync.RWMutex
 	closed       bool
@@ -19,6 +23,17 @@ type ServiceBus struct {
 	logger       logger.CustomLogger
 	ctx          context.Context
 	cancel       context.CancelFunc
+
+	// The subscriptions by topic prefix and the cached routes for the topics
+	// of recent messages
+	subscriptions topicNode
+	routes        map[string][]*subscriber
+
+	// The policy given to new subscriptions
+	overflowPolicy OverflowPolicy
+
+	// Set with the lock held once the subscriber channels are closed
+	stopped bool
 }
 
 // New creates a new ServiceBus
@@ -28,7 +43,7 @@ func New(logger *logger.Logger) *ServiceBus {
 
 	ctx, cancel := context.WithCancel(context.Background())
 	return &ServiceBus{
-		listeners:    make(map[string][]chan *Message),
+		listeners:    make(map[string][]*subscriber),
 		messageQueue: make(chan *Message, 100),
 		logger:       logger.CustomLogger("Service Bus"),
 		ctx:          ctx,
@@ -43,19 +58,16 @@ func (s *ServiceBus) dispatchMessage(message *Message) {
 	s.lock.RLock()
 	defer s.lock.RUnlock()
 
-	// Iterate over listener's topics
-	for topic := range s.listeners {
-
-		// If the topic matches
-		if strings.HasPrefix(message.Topic(), topic) {
+	// The subscriber channels are closed once stopped
+	if s.stopped {
+		return
+	}
 
-			// Iterate over the listeners
-			for _, callback := range s.listeners[topic] {
+	// Iterate over the listeners for the topic
+	for _, sub := range s.route(message.Topic()) {
 
-				// Process the message
-				callback <- message
-			}
-		}
+		// Process the message
+		s.deliver(sub, message)
 	}
 }
 
@@ -64,6 +76,21 @@ func (s *ServiceBus) Debug() {
 	s.debug = true
 }
 
+// SetOverflowPolicy sets what happens to messages for subscribers whose queue
+// is full. It applies to subscriptions made after it is called. The default
+// is Block.
+func (s *ServiceBus) SetOverflowPolicy(policy OverflowPolicy) {
+	s.lock.Lock()
+	defer s.lock.Unlock()
+	s.overflowPolicy = policy
+}
+
+// Dropped returns the number of messages dropped because a subscriber's
+// queue was full
+func (s *ServiceBus) Dropped() uint64 {
+	return atomic.LoadUint64(&s.dropped)
+}
+
 // Start the service bus
 func (s *ServiceBus) Start() error {
 
@@ -118,9 +145,10 @@ func (s *ServiceBus) Stop() error {
 	s.lock.Lock()
 	defer s.lock.Unlock()
 
+	s.stopped = true
 	for _, subscribers := range s.listeners {
-		for _, channel := range subscribers {
-			close(channel)
+		for _, sub := range subscribers {
+			close(sub.channel)
 		}
 	}
 
@@ -137,6 +165,10 @@ func (s *ServiceBus) UnSubscribe(topic string) {
 	s.lock.Lock()
 	defer s.lock.Unlock()
 	s.listeners[topic] = nil
+	if node := s.subscriptions.find(topic); node != nil {
+		node.subscribers = nil
+	}
+	s.routes = nil
 }
 
 // Subscribe is used to register a listener's interest in a topic
@@ -153,29 +185,36 @@ func (s *ServiceBus) Subscribe(topic string) (<-chan *Message, error) {
 	defer s.lock.Unlock()
 
 	// Append the new listener
-	listener := make(chan *Message, 10)
+	listener := &subscriber{
+		channel: make(chan *Message, 10),
+		policy:  s.overflowPolicy,
+	}
 	s.listeners[topic] = append(s.listeners[topic], listener)
-	return (<-chan *Message)(listener), nil
+	s.subscriptions.add(topic, listener)
+	s.routes = nil
+	return (<-chan *Message)(listener.channel), nil
 
 }
 
 // Publish sends the given message on the service bus
-func (s *ServiceBus) Publish(topic string, data interface{}) {
+func (s *ServiceBus) Publish(topic string, data interface{}) error {
 	// Prevent publish when closed
 	if s.closed {
-		return
+		return fmt.Errorf("cannot call publish on closed servicebus")
 	}
 
 	message := NewMessage(topic, data)
 	s.messageQueue <- message
+	return nil
 }
 
 // PublishForTarget sends the given message on the service bus for the given target
-func (s *ServiceBus) PublishForTarget(topic string, data interface{}, target string) {
+func (s *ServiceBus) PublishForTarget(topic string, data interface{}, target string) error {
 	// Prevent publish when closed
 	if s.closed {
-		return
+		return fmt.Errorf("cannot call publish on closed servicebus")
 	}
 	message := NewMessageForTarget(topic, data, target)
 	s.messageQueue <- message
+	return nil
 }
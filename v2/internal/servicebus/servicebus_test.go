@@ -1,6 +1,7 @@
 package servicebus
 
 import (
+	"fmt"
 	"sync"
 	"testing"
 
@@ -38,7 +39,7 @@ func TestSingleTopic(t *testing.T) {
 	var wg sync.WaitGroup
 
 	// Create new bus
-	bus := New(logger.New())
+	bus := New(logger.New(nil))
 	messageChannel, _ := bus.Subscribe("hello")
 
 	wg.Add(1)
@@ -67,7 +68,7 @@ func TestMultipleTopics(t *testing.T) {
 	var wg sync.WaitGroup
 
 	// Create new bus
-	bus := New(logger.New())
+	bus := New(logger.New(nil))
 
 	// Create subscriptions
 	helloChannel, _ := bus.Subscribe("hello")
@@ -108,7 +109,7 @@ func TestSingleTopicWildcard(t *testing.T) {
 	var wg sync.WaitGroup
 
 	// Create new bus
-	bus := New(logger.New())
+	bus := New(logger.New(nil))
 	messageChannel, _ := bus.Subscribe("hello")
 
 	wg.Add(1)
@@ -137,7 +138,7 @@ func TestMultipleTopicsWildcard(t *testing.T) {
 	var wg sync.WaitGroup
 
 	// Create new bus
-	bus := New(logger.New())
+	bus := New(logger.New(nil))
 	helloChannel, _ := bus.Subscribe("hello")
 	worldChannel, _ := bus.Subscribe("world")
 
@@ -176,7 +177,7 @@ func TestStructData(t *testing.T) {
 	var wg sync.WaitGroup
 
 	// Create new bus
-	bus := New(logger.New())
+	bus := New(logger.New(nil))
 	messageChannel, _ := bus.Subscribe("person")
 
 	wg.Add(1)
@@ -201,7 +202,7 @@ func TestErrors(t *testing.T) {
 	is := is.New(t)
 
 	// Create new bus
-	bus := New(logger.New())
+	bus := New(logger.New(nil))
 
 	_, err := bus.Subscribe("person")
 	is.NoErr(err)
@@ -228,3 +229,86 @@ func TestErrors(t *testing.T) {
 	is.True(err != nil)
 
 }
+
+func TestRouting(t *testing.T) {
+
+	is := is.New(t)
+
+	// Create new bus
+	bus := New(logger.New(nil))
+	bus.SetOverflowPolicy(DropNewest)
+	all, _ := bus.Subscribe("")
+	runtime, _ := bus.Subscribe("runtime:")
+	events, _ := bus.Subscribe("runtime:events:")
+	event, _ := bus.Subscribe("event")
+
+	bus.dispatchMessage(NewMessage("runtime:events:emit", nil))
+	bus.dispatchMessage(NewMessage("runtime:window", nil))
+	bus.dispatchMessage(NewMessage("events", nil))
+	bus.dispatchMessage(NewMessage("runtime", nil))
+
+	is.Equal(len(all), 4)
+	is.Equal(len(runtime), 2)
+	is.Equal(len(events), 1)
+	is.Equal(len(event), 1)
+
+	// Unsubscribing stops delivery, including for cached routes
+	bus.UnSubscribe("runtime:")
+	bus.dispatchMessage(NewMessage("runtime:events:emit", nil))
+	is.Equal(len(runtime), 2)
+	is.Equal(len(events), 2)
+}
+
+func TestOverflowPolicies(t *testing.T) {
+
+	is := is.New(t)
+
+	bus := New(logger.New(nil))
+	bus.SetOverflowPolicy(DropNewest)
+	newest, _ := bus.Subscribe("topic")
+	bus.SetOverflowPolicy(DropOldest)
+	oldest, _ := bus.Subscribe("topic")
+
+	for i := 0; i < 15; i++ {
+		bus.dispatchMessage(NewMessage("topic", i))
+	}
+
+	// The first 10 fit in the queue and the next 5 don't
+	is.Equal(len(newest), 10)
+	is.Equal((<-newest).Data().(int), 0)
+	is.Equal(len(oldest), 10)
+	is.Equal((<-oldest).Data().(int), 5)
+	is.Equal(bus.Dropped(), uint64(10))
+}
+
+// BenchmarkDispatch dispatches messages across 200 topics, each with a
+// subscriber draining its queue. Use -benchtime=1000000x for 1M messages.
+func BenchmarkDispatch(b *testing.B) {
+	const topics = 200
+
+	bus := New(logger.New(nil))
+	var wg sync.WaitGroup
+	for i := 0; i < topics; i++ {
+		channel, _ := bus.Subscribe(fmt.Sprintf("topic%d:", i))
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for range channel {
+			}
+		}()
+	}
+	messages := make([]*Message, topics)
+	for i := range messages {
+		messages[i] = NewMessage(fmt.Sprintf("topic%d:sub:event", i), i)
+	}
+
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		bus.dispatchMessage(messages[i%topics])
+	}
+	b.StopTimer()
+
+	bus.Stop()
+	wg.Wait()
+}
@@ -14,6 +14,9 @@ import (
 	"github.com/wailsapp/wails/v2/internal/servicebus"
 )
 
+// The number of calls processed at once
+const maxConcurrentCalls = 64
+
 // Call is the Call subsystem. It manages all service bus messages
 // starting with "call".
 type Call struct {
@@ -67,13 +70,27 @@ func (c *Call) Start() error {
 	// Spin off a go routine
 	go func() {
 		defer c.logger.Trace("Shutdown")
+		inProgress := make(chan struct{}, maxConcurrentCalls)
 		for {
 			select {
 			case <-c.ctx.Done():
 				c.wg.Done()
 				return
 			case callMessage := <-c.callChannel:
-				c.processCall(callMessage)
+				// Calls are processed concurrently so a slow method doesn't
+				// hold up the others. Results carry the call's callback ID
+				select {
+				case inProgress <- struct{}{}:
+				case <-c.ctx.Done():
+					c.wg.Done()
+					return
+				}
+				c.wg.Add(1)
+				go func() {
+					defer c.wg.Done()
+					defer func() { <-inProgress }()
+					c.processCall(callMessage)
+				}()
 			}
 		}
 
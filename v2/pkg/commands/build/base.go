@@ -9,6 +9,7 @@ import (
 	"runtime"
 	"strconv"
 	"strings"
+	"sync"
 
 	"github.com/wailsapp/wails/v2/internal/system"
 
@@ -20,6 +21,7 @@ import (
 
 	"github.com/leaanthony/slicer"
 	"github.com/wailsapp/wails/v2/internal/assetdb"
+	"github.com/wailsapp/wails/v2/internal/cbytes"
 	"github.com/wailsapp/wails/v2/internal/fs"
 	"github.com/wailsapp/wails/v2/internal/html"
 	"github.com/wailsapp/wails/v2/internal/project"
@@ -33,9 +35,10 @@ const (
 
 // BaseBuilder is the common builder struct
 type BaseBuilder struct {
-	filesToDelete slicer.StringSlicer
-	projectData   *project.Project
-	options       *Options
+	filesToDelete     slicer.StringSlicer
+	filesToDeleteLock sync.Mutex
+	projectData       *project.Project
+	options           *Options
 }
 
 // NewBaseBuilder creates a new BaseBuilder
@@ -53,7 +56,9 @@ func (b *BaseBuilder) SetProjectData(projectData *project.Project) {
 
 func (b *BaseBuilder) addFileToDelete(filename string) {
 	if !b.options.KeepAssets {
+		b.filesToDeleteLock.Lock()
 		b.filesToDelete.Add(filename)
+		b.filesToDeleteLock.Unlock()
 	}
 }
 
@@ -118,22 +123,34 @@ func (b *BaseBuilder) convertFileToIntegerString(filename string) (string, error
 }
 
 func (b *BaseBuilder) convertByteSliceToIntegerString(data []byte) string {
+	result := cbytes.Append(make([]byte, 0, cbytes.EncodedLength(data)), data)
 
-	// Create string builder
-	var result strings.Builder
-
-	if len(data) > 0 {
+	// Drop the trailing comma
+	if len(result) > 0 {
+		result = result[:len(result)-1]
+	}
+	return string(result)
+}
 
-		// Loop over all but 1 bytes
-		for i := 0; i < len(data)-1; i++ {
-			result.WriteString(fmt.Sprintf("%v,", data[i]))
+// runConcurrently runs the given stages concurrently. Once they have all
+// finished, it returns the first error returned by any of them.
+func runConcurrently(stages ...func() error) error {
+	var wg sync.WaitGroup
+	results := make([]error, len(stages))
+	for index, stage := range stages {
+		wg.Add(1)
+		go func(index int, stage func() error) {
+			defer wg.Done()
+			results[index] = stage()
+		}(index, stage)
+	}
+	wg.Wait()
+	for _, err := range results {
+		if err != nil {
+			return err
 		}
-
-		result.WriteString(fmt.Sprintf("%v", data[len(data)-1]))
-
 	}
-
-	return result.String()
+	return nil
 }
 
 // CleanUp does post-build housekeeping
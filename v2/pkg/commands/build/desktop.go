@@ -1,10 +1,10 @@
 package build
 
 import (
-	"fmt"
 	"os"
 	"path/filepath"
 
+	"github.com/wailsapp/wails/v2/internal/cbytes"
 	"github.com/wailsapp/wails/v2/internal/fs"
 	"github.com/wailsapp/wails/v2/internal/html"
 	"github.com/wailsapp/wails/v2/pkg/buildassets"
@@ -73,27 +73,28 @@ func (d *DesktopBuilder) BuildBaseAssets(assets *html.AssetBundle, options *Opti
 		}
 	}
 
-	// Dump assets as C
-	assetsFile, err := assets.WriteToCFile(assetDir)
-	if err != nil {
-		return err
-	}
-	d.addFileToDelete(assetsFile)
-
-	// Process Icon
-	err = d.processApplicationIcon(assetDir)
-	if err != nil {
-		return err
-	}
-
-	// Process Tray Icons
-	err = d.processTrayIcons(assetDir, options)
-	if err != nil {
-		return err
-	}
-
-	// Process Dialog Icons
-	err = d.processDialogIcons(assetDir, options)
+	// The stages write separate files so run them together. The headers
+	// record a hash of their inputs and are left in the build directory, so
+	// the next build only regenerates the ones whose inputs have changed.
+	err = runConcurrently(
+		// Dump assets as C
+		func() error {
+			_, err := assets.WriteToCFile(assetDir)
+			return err
+		},
+		// Process Icon
+		func() error {
+			return d.processApplicationIcon(assetDir)
+		},
+		// Process Tray Icons
+		func() error {
+			return d.processTrayIcons(assetDir, options)
+		},
+		// Process Dialog Icons
+		func() error {
+			return d.processDialogIcons(assetDir, options)
+		},
+	)
 	if err != nil {
 		return err
 	}
@@ -145,20 +146,18 @@ func (d *DesktopBuilder) BuildRuntime(options *Options) error {
 	outputLogger.Println("done.")
 
 	// Convert to C structure
-	runtimeC := `
+	runtimeC := []byte(`
 // runtime.c (c) 2019-Present Lea Anthony.
 // Cynhyrchwyd y ffeil hon yn awtomatig. PEIDIWCH Â MODIWL
 // This file was auto-generated. DO NOT MODIFY.
-const unsigned char runtime[]={`
-	for _, b := range runtimeData {
-		runtimeC += fmt.Sprintf("0x%x, ", b)
-	}
-	runtimeC += "0x00};"
+const unsigned char runtime[]={`)
+	runtimeC = cbytes.Append(runtimeC, runtimeData)
+	runtimeC = append(runtimeC, "0x00};"...)
 
 	// Save file
 	outputFile := fs.RelativePath("../../../internal/ffenestri/runtime.c")
 
-	if err := os.WriteFile(outputFile, []byte(runtimeC), 0600); err != nil {
+	if err := os.WriteFile(outputFile, runtimeC, 0600); err != nil {
 		return err
 	}
 
@@ -12,15 +12,87 @@ import (
 	"strings"
 
 	"github.com/leaanthony/slicer"
+	"github.com/wailsapp/wails/v2/internal/cbytes"
 	"github.com/wailsapp/wails/v2/internal/fs"
 )
 
 func (d *DesktopBuilder) convertToHexLiteral(bytes []byte) string {
-	result := ""
-	for _, b := range bytes {
-		result += fmt.Sprintf("0x%x, ", b)
+	return cbytes.String(bytes)
+}
+
+// iconsHeaderVersion is hashed with the icons, so that headers generated by an
+// older build are regenerated. Change it when the header written by
+// compileIconsHeader changes.
+const iconsHeaderVersion = "icons-1"
+
+// compileIconsHeader writes the given PNG files to the C header targetFile.
+// Each icon is written as <prefix><n>Name, <prefix><n>Length and
+// <prefix><n>Data arrays, which are listed in the array arrayName. If the
+// header was already generated from the same icons, it is left as it is.
+func (d *DesktopBuilder) compileIconsHeader(targetFile string, iconFilenames []string, prefix string, arrayName string) error {
+
+	// Load the icons
+	inputs := [][]byte{[]byte(iconsHeaderVersion), []byte(prefix), []byte(arrayName)}
+	iconData := make([][]byte, len(iconFilenames))
+	for index, filename := range iconFilenames {
+		dataBytes, err := os.ReadFile(filename)
+		if err != nil {
+			return err
+		}
+		iconData[index] = dataBytes
+		inputs = append(inputs, []byte(filepath.Base(filename)), dataBytes)
+	}
+	inputsHash := fs.HashInputs(inputs...)
+	if fs.GeneratedFileIsCurrent(targetFile, inputsHash) {
+		return nil
 	}
-	return result
+
+	// Use a byte buffer sized for the encoded data
+	size := 256
+	for _, dataBytes := range iconData {
+		size += 4*len(dataBytes) + 256
+	}
+	cdata := make([]byte, 0, size)
+
+	// Write header
+	cdata = append(cdata, "// "+filepath.Base(targetFile)+`
+// Cynhyrchwyd y ffeil hon yn awtomatig. PEIDIWCH Â MODIWL.
+// This file was auto-generated. DO NOT MODIFY.
+
+`...)
+
+	var variableList slicer.StringSlicer
+
+	// Loop over icons
+	for count, filename := range iconFilenames {
+		dataBytes := iconData[count]
+
+		iconname := strings.TrimSuffix(filepath.Base(filename), ".png")
+		iconName := fmt.Sprintf("%s%dName", prefix, count)
+		variableList.Add(iconName)
+		cdata = append(cdata, fmt.Sprintf("const unsigned char %s[] = { %s0x00 };\n", iconName, d.convertToHexLiteral([]byte(iconname)))...)
+
+		iconLength := fmt.Sprintf("%s%dLength", prefix, count)
+		variableList.Add(iconLength)
+		lengthAsString := strconv.Itoa(len(dataBytes))
+		cdata = append(cdata, fmt.Sprintf("const unsigned char %s[] = { %s0x00 };\n", iconLength, d.convertToHexLiteral([]byte(lengthAsString)))...)
+
+		iconDataName := fmt.Sprintf("%s%dData", prefix, count)
+		variableList.Add(iconDataName)
+		cdata = append(cdata, fmt.Sprintf("const unsigned char %s[] = { ", iconDataName)...)
+		cdata = cbytes.Append(cdata, dataBytes)
+		cdata = append(cdata, "0x00 };\n"...)
+	}
+
+	// Write out main icons data
+	cdata = append(cdata, "const unsigned char *"+arrayName+"[] = { "...)
+	cdata = append(cdata, variableList.Join(", ")...)
+	if len(iconFilenames) > 0 {
+		cdata = append(cdata, ", "...)
+	}
+	cdata = append(cdata, "0x00 };\n"...)
+
+	return fs.WriteGeneratedFile(targetFile, inputsHash, cdata, 0600)
 }
 
 // compileIcon will compile the icon found at <projectdir>/icon.png into the application
@@ -54,67 +126,8 @@ func (d *DesktopBuilder) processTrayIcons(assetDir string, options *Options) err
 	// Setup target
 	targetFilename := "trayicons"
 	targetFile := filepath.Join(assetDir, targetFilename+".h")
-	d.addFileToDelete(targetFile)
-
-	var dataBytes []byte
-
-	// Use a strings builder
-	var cdata strings.Builder
-
-	// Write header
-	header := `// trayicons.h
-// Cynhyrchwyd y ffeil hon yn awtomatig. PEIDIWCH Â MODIWL.
-// This file was auto-generated. DO NOT MODIFY.
-
-`
-	cdata.WriteString(header)
-
-	var variableList slicer.StringSlicer
-
-	// Loop over icons
-	for count, filename := range trayIconFilenames {
-
-		// Load the tray icon
-		dataBytes, err = os.ReadFile(filename)
-		if err != nil {
-			return err
-		}
-
-		iconname := strings.TrimSuffix(filepath.Base(filename), ".png")
-		trayIconName := fmt.Sprintf("trayIcon%dName", count)
-		variableList.Add(trayIconName)
-		cdata.WriteString(fmt.Sprintf("const unsigned char %s[] = { %s0x00 };\n", trayIconName, d.convertToHexLiteral([]byte(iconname))))
 
-		trayIconLength := fmt.Sprintf("trayIcon%dLength", count)
-		variableList.Add(trayIconLength)
-		lengthAsString := strconv.Itoa(len(dataBytes))
-		cdata.WriteString(fmt.Sprintf("const unsigned char %s[] = { %s0x00 };\n", trayIconLength, d.convertToHexLiteral([]byte(lengthAsString))))
-
-		trayIconData := fmt.Sprintf("trayIcon%dData", count)
-		variableList.Add(trayIconData)
-		cdata.WriteString(fmt.Sprintf("const unsigned char %s[] = { ", trayIconData))
-
-		// Convert each byte to hex
-		for _, b := range dataBytes {
-			cdata.WriteString(fmt.Sprintf("0x%x, ", b))
-		}
-
-		cdata.WriteString("0x00 };\n")
-	}
-
-	// Write out main trayIcons data
-	cdata.WriteString("const unsigned char *trayIcons[] = { ")
-	cdata.WriteString(variableList.Join(", "))
-	if len(trayIconFilenames) > 0 {
-		cdata.WriteString(", ")
-	}
-	cdata.WriteString("0x00 };\n")
-
-	err = os.WriteFile(targetFile, []byte(cdata.String()), 0600)
-	if err != nil {
-		return err
-	}
-	return nil
+	return d.compileIconsHeader(targetFile, trayIconFilenames, "trayIcon", "trayIcons")
 }
 
 // PostCompilation is called after the compilation step, if successful
@@ -148,65 +161,6 @@ func (d *DesktopBuilder) processDialogIcons(assetDir string, options *Options) e
 	// Setup target
 	targetFilename := "userdialogicons"
 	targetFile := filepath.Join(assetDir, targetFilename+".h")
-	d.addFileToDelete(targetFile)
-
-	var dataBytes []byte
-
-	// Use a strings builder
-	var cdata strings.Builder
-
-	// Write header
-	header := `// userdialogicons.h
-// Cynhyrchwyd y ffeil hon yn awtomatig. PEIDIWCH Â MODIWL.
-// This file was auto-generated. DO NOT MODIFY.
-
-`
-	cdata.WriteString(header)
-
-	var variableList slicer.StringSlicer
 
-	// Loop over icons
-	for count, filename := range dialogIconFilenames {
-
-		// Load the tray icon
-		dataBytes, err = os.ReadFile(filename)
-		if err != nil {
-			return err
-		}
-
-		iconname := strings.TrimSuffix(filepath.Base(filename), ".png")
-		dialogIconName := fmt.Sprintf("userDialogIcon%dName", count)
-		variableList.Add(dialogIconName)
-		cdata.WriteString(fmt.Sprintf("const unsigned char %s[] = { %s0x00 };\n", dialogIconName, d.convertToHexLiteral([]byte(iconname))))
-
-		dialogIconLength := fmt.Sprintf("userDialogIcon%dLength", count)
-		variableList.Add(dialogIconLength)
-		lengthAsString := strconv.Itoa(len(dataBytes))
-		cdata.WriteString(fmt.Sprintf("const unsigned char %s[] = { %s0x00 };\n", dialogIconLength, d.convertToHexLiteral([]byte(lengthAsString))))
-
-		dialogIconData := fmt.Sprintf("userDialogIcon%dData", count)
-		variableList.Add(dialogIconData)
-		cdata.WriteString(fmt.Sprintf("const unsigned char %s[] = { ", dialogIconData))
-
-		// Convert each byte to hex
-		for _, b := range dataBytes {
-			cdata.WriteString(fmt.Sprintf("0x%x, ", b))
-		}
-
-		cdata.WriteString("0x00 };\n")
-	}
-
-	// Write out main dialogIcons data
-	cdata.WriteString("const unsigned char *userDialogIcons[] = { ")
-	cdata.WriteString(variableList.Join(", "))
-	if len(dialogIconFilenames) > 0 {
-		cdata.WriteString(", ")
-	}
-	cdata.WriteString("0x00 };\n")
-
-	err = os.WriteFile(targetFile, []byte(cdata.String()), 0600)
-	if err != nil {
-		return err
-	}
-	return nil
+	return d.compileIconsHeader(targetFile, dialogIconFilenames, "userDialogIcon", "userDialogIcons")
 }
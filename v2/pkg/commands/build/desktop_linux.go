@@ -3,49 +3,133 @@
 
 package build
 
-// compileIcon will compile the icon found at <projectdir>/icon.png into the application
+import (
+	"bytes"
+	"fmt"
+	"image"
+	"image/color"
+	"image/png"
+	"os"
+	"path/filepath"
+	"strconv"
+	"strings"
+
+	"github.com/leaanthony/slicer"
+	"github.com/wailsapp/wails/v2/internal/fs"
+)
+
+// appIconSizes are the sizes the application icon is compiled at. Sizes larger
+// than the source icon are skipped.
+var appIconSizes = []int{16, 24, 32, 48, 64, 128, 256}
+
+// iconHeaderVersion is hashed with the icon, so that icon.h files generated
+// by an older build are regenerated. Change it when the header written by
+// iconToRGBAHeader changes, including appIconSizes.
+const iconHeaderVersion = "rgba-1"
+
+// compileIcon will compile the icon found at <projectdir>/icon.png into the application.
+// The icon is decoded and scaled at build time and written as raw RGBA so
+// that it can be handed to GTK without parsing at runtime.
 func (d *DesktopBuilder) compileIcon(assetDir string, iconFile string) error {
-	//
-	//// Load icon into a databuffer
-	//targetFilename := "icon"
-	//targetFile := filepath.Join(assetDir, targetFilename+".h")
-	//
-	//d.addFileToDelete(targetFile)
-	//
-	//// Create a new XPM encoder
-	//enc := xpm.NewEncoder(targetFilename)
-	//
-	//// Open the PNG file
-	//f, err := os.Open(iconFile)
-	//if err != nil {
-	//	return err
-	//}
-	//m, err := png.Decode(f)
-	//if err != nil {
-	//	return err
-	//}
-	//err = f.Close()
-	//if err != nil {
-	//	return err
-	//}
-	//
-	//var buf strings.Builder
-	//
-	//// Generate and output the XPM data
-	//err = enc.Encode(&buf, m)
-	//if err != nil {
-	//	return err
-	//}
-	//
-	//// Massage the output so we can extern reference it
-	//output := buf.String()
-	//output = strings.Replace(output, "static char", "const char", 1)
-	//
-	//// save icon.c
-	//err = os.WriteFile(targetFile, []byte(output), 0755)
-	//
-	//return err
-	return nil
+
+	targetFile := filepath.Join(assetDir, "icon.h")
+
+	// Load the PNG
+	data, err := os.ReadFile(iconFile)
+	if err != nil {
+		return err
+	}
+	inputsHash := fs.HashInputs([]byte(iconHeaderVersion), data)
+	if fs.GeneratedFileIsCurrent(targetFile, inputsHash) {
+		return nil
+	}
+	m, err := png.Decode(bytes.NewReader(data))
+	if err != nil {
+		return err
+	}
+
+	return fs.WriteGeneratedFile(targetFile, inputsHash, []byte(d.iconToRGBAHeader(m)), 0600)
+}
+
+// iconToRGBAHeader scales the given image to each of the appIconSizes and
+// returns a C header containing the non-premultiplied RGBA data for each
+func (d *DesktopBuilder) iconToRGBAHeader(m image.Image) string {
+
+	largest := m.Bounds().Dx()
+	if m.Bounds().Dy() > largest {
+		largest = m.Bounds().Dy()
+	}
+	var sizes []int
+	for _, size := range appIconSizes {
+		if size <= largest {
+			sizes = append(sizes, size)
+		}
+	}
+	if len(sizes) == 0 {
+		sizes = append(sizes, largest)
+	}
+
+	var cdata strings.Builder
+	cdata.WriteString(`// icon.h
+// Cynhyrchwyd y ffeil hon yn awtomatig. PEIDIWCH Â MODIWL.
+// This file was auto-generated. DO NOT MODIFY.
+
+`)
+	var variableList slicer.StringSlicer
+	var sizeList slicer.StringSlicer
+	for _, size := range sizes {
+		iconData := fmt.Sprintf("iconData%d", size)
+		variableList.Add(iconData)
+		sizeList.Add(strconv.Itoa(size))
+		cdata.WriteString(fmt.Sprintf("const unsigned char %s[] = { ", iconData))
+		cdata.WriteString(d.convertByteSliceToIntegerString(scaleIcon(m, size).Pix))
+		cdata.WriteString(" };\n")
+	}
+	cdata.WriteString(fmt.Sprintf("const int iconCount = %d;\n", len(sizes)))
+	cdata.WriteString("const int iconSizes[] = { " + sizeList.Join(", ") + " };\n")
+	cdata.WriteString("const unsigned char *iconData[] = { " + variableList.Join(", ") + " };\n")
+	return cdata.String()
+}
+
+// scaleIcon scales m to a size x size image by averaging the source pixels
+// covered by each target pixel. Colours are averaged premultiplied so that
+// transparent pixels don't darken the edges.
+func scaleIcon(m image.Image, size int) *image.NRGBA {
+	bounds := m.Bounds()
+	result := image.NewNRGBA(image.Rect(0, 0, size, size))
+	for y := 0; y < size; y++ {
+		y0 := bounds.Min.Y + y*bounds.Dy()/size
+		y1 := bounds.Min.Y + (y+1)*bounds.Dy()/size
+		if y1 == y0 {
+			y1++
+		}
+		for x := 0; x < size; x++ {
+			x0 := bounds.Min.X + x*bounds.Dx()/size
+			x1 := bounds.Min.X + (x+1)*bounds.Dx()/size
+			if x1 == x0 {
+				x1++
+			}
+			var r, g, b, a, count uint64
+			for sy := y0; sy < y1; sy++ {
+				for sx := x0; sx < x1; sx++ {
+					pr, pg, pb, pa := m.At(sx, sy).RGBA()
+					r += uint64(pr)
+					g += uint64(pg)
+					b += uint64(pb)
+					a += uint64(pa)
+					count++
+				}
+			}
+			average := color.RGBA64{
+				R: uint16(r / count),
+				G: uint16(g / count),
+				B: uint16(b / count),
+				A: uint16(a / count),
+			}
+			result.Set(x, y, average)
+		}
+	}
+	return result
 }
 
 // We will compile all tray icons found at <projectdir>/assets/trayicons/*.png into the application
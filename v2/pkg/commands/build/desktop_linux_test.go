@@ -0,0 +1,72 @@
+package build
+
+import (
+	"image"
+	"image/color"
+	"regexp"
+	"strconv"
+	"strings"
+	"testing"
+)
+
+func TestScaleIcon(t *testing.T) {
+	// Left half opaque red, right half fully transparent
+	m := image.NewNRGBA(image.Rect(0, 0, 4, 4))
+	for y := 0; y < 4; y++ {
+		for x := 0; x < 2; x++ {
+			m.Set(x, y, color.NRGBA{R: 255, A: 255})
+		}
+	}
+
+	scaled := scaleIcon(m, 2)
+	if got := scaled.NRGBAAt(0, 1); got != (color.NRGBA{R: 255, A: 255}) {
+		t.Errorf("expected opaque red, got %v", got)
+	}
+	if got := scaled.NRGBAAt(1, 1); got.A != 0 {
+		t.Errorf("expected transparent, got %v", got)
+	}
+
+	// The transparent half must not darken the red when averaged together
+	if got := scaleIcon(m, 1).NRGBAAt(0, 0); got.R != 255 || got.A != 127 {
+		t.Errorf("expected half transparent red, got %v", got)
+	}
+
+	// Upscaling repeats pixels
+	if got := scaleIcon(m, 8).NRGBAAt(3, 7); got != (color.NRGBA{R: 255, A: 255}) {
+		t.Errorf("expected opaque red, got %v", got)
+	}
+}
+
+func TestIconToRGBAHeader(t *testing.T) {
+	d := &DesktopBuilder{BaseBuilder: &BaseBuilder{}}
+	tests := []struct {
+		size     int
+		expected string
+	}{
+		{8, "8"},
+		{20, "16"},
+		{64, "16, 24, 32, 48, 64"},
+		{1024, "16, 24, 32, 48, 64, 128, 256"},
+	}
+	for _, test := range tests {
+		header := d.iconToRGBAHeader(image.NewNRGBA(image.Rect(0, 0, test.size, test.size)))
+		if !strings.Contains(header, "const int iconSizes[] = { "+test.expected+" };") {
+			t.Errorf("%d: unexpected sizes in\n%s", test.size, header)
+			continue
+		}
+		sizes := strings.Split(test.expected, ", ")
+		arrays := regexp.MustCompile(`const unsigned char iconData(\d+)\[\] = \{ ([\d,]*) \};`).FindAllStringSubmatch(header, -1)
+		if len(arrays) != len(sizes) {
+			t.Fatalf("%d: expected %d arrays, got %d", test.size, len(sizes), len(arrays))
+		}
+		for index, array := range arrays {
+			if array[1] != sizes[index] {
+				t.Errorf("%d: expected iconData%s, got iconData%s", test.size, sizes[index], array[1])
+			}
+			size, _ := strconv.Atoi(array[1])
+			if values := strings.Count(array[2], ",") + 1; values != size*size*4 {
+				t.Errorf("%d: expected %d bytes for size %d, got %d", test.size, size*size*4, size, values)
+			}
+		}
+	}
+}
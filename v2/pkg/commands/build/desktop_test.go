@@ -0,0 +1,198 @@
+package build
+
+import (
+	"fmt"
+	"image"
+	"image/color"
+	"image/png"
+	"io"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+	"time"
+
+	"github.com/wailsapp/wails/v2/internal/html"
+	"github.com/wailsapp/wails/v2/internal/project"
+	"github.com/wailsapp/wails/v2/pkg/clilogger"
+)
+
+// writeTestPNG writes a size x size PNG with some detail so that it doesn't
+// compress away to nothing
+func writeTestPNG(filename string, size int, seed int) error {
+	m := image.NewNRGBA(image.Rect(0, 0, size, size))
+	for y := 0; y < size; y++ {
+		for x := 0; x < size; x++ {
+			m.Set(x, y, color.NRGBA{R: uint8(x*seed + y), G: uint8(y * 7), B: uint8(x ^ y ^ seed), A: 255})
+		}
+	}
+	f, err := os.Create(filename)
+	if err != nil {
+		return err
+	}
+	err = png.Encode(f, m)
+	if closeErr := f.Close(); err == nil {
+		err = closeErr
+	}
+	return err
+}
+
+// newSyntheticProject creates a project with the given number of JS and CSS
+// assets and tray and dialog icons
+func newSyntheticProject(dir string, assets int, icons int) (*project.Project, *html.AssetBundle, error) {
+	projectData := &project.Project{
+		Path:     dir,
+		BuildDir: filepath.Join(dir, "build"),
+	}
+	for _, subdir := range []string{"frontend", "build/tray", "build/dialog"} {
+		if err := os.MkdirAll(filepath.Join(dir, subdir), 0755); err != nil {
+			return nil, nil, err
+		}
+	}
+
+	var index strings.Builder
+	index.WriteString("<html><head>\n")
+	for i := 0; i < assets; i++ {
+		var filename, tag, content string
+		if i%2 == 0 {
+			filename = fmt.Sprintf("script%d.js", i)
+			tag = fmt.Sprintf("<script src=\"%s\"></script>\n", filename)
+			content = strings.Repeat(fmt.Sprintf("function f%d(a, b) { return a + b * %d; }\n", i, i), 200)
+		} else {
+			filename = fmt.Sprintf("style%d.css", i)
+			tag = fmt.Sprintf("<link rel=\"stylesheet\" href=\"%s\">\n", filename)
+			content = strings.Repeat(fmt.Sprintf(".c%d {\n  margin: %dpx;\n  color: #abc;\n}\n", i, i), 200)
+		}
+		index.WriteString(tag)
+		if err := os.WriteFile(filepath.Join(dir, "frontend", filename), []byte(content), 0644); err != nil {
+			return nil, nil, err
+		}
+	}
+	index.WriteString("</head><body></body></html>\n")
+	indexFile := filepath.Join(dir, "frontend", "index.html")
+	if err := os.WriteFile(indexFile, []byte(index.String()), 0644); err != nil {
+		return nil, nil, err
+	}
+
+	if err := writeTestPNG(filepath.Join(projectData.BuildDir, "appicon.png"), 1024, 1); err != nil {
+		return nil, nil, err
+	}
+	for i := 0; i < icons; i++ {
+		subdir := "tray"
+		if i%2 == 1 {
+			subdir = "dialog"
+		}
+		if err := writeTestPNG(filepath.Join(projectData.BuildDir, subdir, fmt.Sprintf("icon%d.png", i)), 64, i); err != nil {
+			return nil, nil, err
+		}
+	}
+
+	bundle, err := html.NewAssetBundle(indexFile)
+	return projectData, bundle, err
+}
+
+// chdir changes to dir until the test finishes
+func chdir(tb testing.TB, dir string) {
+	cwd, err := os.Getwd()
+	if err != nil {
+		tb.Fatal(err)
+	}
+	if err := os.Chdir(dir); err != nil {
+		tb.Fatal(err)
+	}
+	tb.Cleanup(func() { os.Chdir(cwd) })
+}
+
+// TestBuildBaseAssetsKeepsHeaders checks that the generated headers survive
+// CleanUp with the default options, and are reused by the next build
+func TestBuildBaseAssetsKeepsHeaders(t *testing.T) {
+	dir := t.TempDir()
+	projectData, bundle, err := newSyntheticProject(dir, 4, 2)
+	if err != nil {
+		t.Fatal(err)
+	}
+	chdir(t, dir)
+
+	options := &Options{
+		Logger:      clilogger.New(io.Discard),
+		ProjectData: projectData,
+	}
+	build := func() {
+		t.Helper()
+		builder := newDesktopBuilder(options)
+		builder.SetProjectData(projectData)
+		if err := builder.BuildBaseAssets(bundle, options); err != nil {
+			t.Fatal(err)
+		}
+		builder.CleanUp()
+	}
+
+	build()
+	headers, err := filepath.Glob(filepath.Join(dir, "build", "*.h"))
+	if err != nil {
+		t.Fatal(err)
+	}
+	if len(headers) == 0 {
+		t.Fatal("expected generated headers to be kept after CleanUp")
+	}
+
+	// Unchanged headers are not written again
+	old := time.Now().Add(-time.Hour).Truncate(time.Second)
+	for _, header := range headers {
+		if err := os.Chtimes(header, old, old); err != nil {
+			t.Fatal(err)
+		}
+	}
+	build()
+	for _, header := range headers {
+		info, err := os.Stat(header)
+		if err != nil {
+			t.Fatal(err)
+		}
+		if !info.ModTime().Equal(old) {
+			t.Errorf("%s was regenerated", filepath.Base(header))
+		}
+	}
+}
+
+// BenchmarkBuildBaseAssets builds the assets of a project with 500 assets and
+// 50 icons, from scratch and with nothing changed since the last build
+func BenchmarkBuildBaseAssets(b *testing.B) {
+	dir := b.TempDir()
+	projectData, bundle, err := newSyntheticProject(dir, 500, 50)
+	if err != nil {
+		b.Fatal(err)
+	}
+
+	chdir(b, dir)
+
+	options := &Options{
+		Logger:      clilogger.New(io.Discard),
+		ProjectData: projectData,
+	}
+	builder := newDesktopBuilder(options)
+	builder.SetProjectData(projectData)
+
+	b.Run("clean", func(b *testing.B) {
+		for i := 0; i < b.N; i++ {
+			b.StopTimer()
+			for _, header := range []string{"assets.h", "icon.h", "trayicons.h", "userdialogicons.h"} {
+				os.Remove(filepath.Join(dir, "build", header))
+			}
+			b.StartTimer()
+			if err := builder.BuildBaseAssets(bundle, options); err != nil {
+				b.Fatal(err)
+			}
+			builder.CleanUp()
+		}
+	})
+
+	b.Run("unchanged", func(b *testing.B) {
+		for i := 0; i < b.N; i++ {
+			if err := builder.BuildBaseAssets(bundle, options); err != nil {
+				b.Fatal(err)
+			}
+			builder.CleanUp()
+		}
+	})
+}
@@ -52,6 +52,10 @@ type App struct {
 	Bind              []interface{}
 	WindowStartState  WindowStartState
 
+	// CompactIPC makes the runtime send calls and events to Go as compact
+	// frames instead of JSON text messages
+	CompactIPC bool
+
 	//ContextMenus []*menu.ContextMenu
 	//TrayMenus    []*menu.TrayMenu
 	Windows *windows.Options
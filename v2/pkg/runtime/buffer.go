@@ -0,0 +1,17 @@
+package runtime
+
+import (
+	"context"
+
+	"github.com/wailsapp/wails/v2/internal/frontend/desktop/common"
+)
+
+// PublishBuffer makes data available to the frontend and returns the URL to
+// fetch it from, eg: `await (await fetch(url)).arrayBuffer()`. The buffer can
+// be fetched once and is dropped if it isn't fetched within a minute. data is
+// not copied, so must not be modified until it has been fetched.
+func PublishBuffer(ctx context.Context, data []byte) string {
+	// Check the context is valid
+	getFrontend(ctx)
+	return common.BufferPath + common.Buffers.Publish(data)
+}
@@ -2,8 +2,25 @@ package runtime
 
 import (
 	"context"
+
+	"github.com/wailsapp/wails/v2/internal/frontend"
+)
+
+// EventPolicy limits how often an event emitted in Go is sent to the frontend
+type EventPolicy = frontend.EventPolicy
+
+type EventDelivery = frontend.EventDelivery
+
+const (
+	DeliverEvery     = frontend.DeliverEvery
+	DeliverLatest    = frontend.DeliverLatest
+	DeliverBatch     = frontend.DeliverBatch
+	DeliverThrottled = frontend.DeliverThrottled
 )
 
+// EventPolicyStats counts the events held back by an EventPolicy
+type EventPolicyStats = frontend.EventPolicyStats
+
 // EventsOn registers a listener for the given event name
 func EventsOn(ctx context.Context, eventName string, callback func(optionalData ...interface{})) {
 	events := getEvents(ctx)
@@ -34,3 +51,16 @@ func EventsEmit(ctx context.Context, eventName string, optionalData ...interface
 	events := getEvents(ctx)
 	events.Emit(eventName, optionalData...)
 }
+
+// EventsSetPolicy sets how often the given event is sent to the frontend when
+// emitted in Go
+func EventsSetPolicy(ctx context.Context, eventName string, policy EventPolicy) {
+	events := getEvents(ctx)
+	events.SetPolicy(eventName, policy)
+}
+
+// EventsPolicyStats returns how many of the given event its policy has held back
+func EventsPolicyStats(ctx context.Context, eventName string) EventPolicyStats {
+	events := getEvents(ctx)
+	return events.PolicyStats(eventName)
+}